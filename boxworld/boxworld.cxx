@@ -26,6 +26,7 @@
 //-------------------------------------------------------------------------
 
 #include "image565Font8x8.h"
+#include "image565Graphics.h"
 #include "image565Process.h"
 
 #include "boxworld.h"
@@ -46,20 +47,14 @@ Boxworld::Boxworld(bool fitToScreen)
     m_board(),
     m_boardPrevious(),
     m_levels(),
-    m_tileBuffers(
-        {
-            { c_tileDimensions, c_emptyImage },
-            { c_tileDimensions, c_passageImage },
-            { c_tileDimensions, c_boxImage },
-            { c_tileDimensions, c_playerImage, 2 },
-            { c_tileDimensions, c_wallImage },
-            { c_tileDimensions, c_passageWithTargetImage },
-            { c_tileDimensions, c_boxOnTargetImage },
-            { c_tileDimensions, c_playerOnTargetImage, 2 }
-        }),
+    m_tiles(),
+    m_tileSprites(),
+    m_tileMap{c_tileDimensions,
+              fb16::Dimensions565{Level::c_levelWidth, Level::c_levelHeight}},
+    m_canvas(),
+    m_textDrawn(),
     m_topTextImage{fb16::Dimensions565{240, 8}},
     m_bottomTextImage{fb16::Dimensions565{320, 16}},
-    m_image{fb16::Dimensions565{320, 240}},
     m_textRGB(255, 255, 255),
     m_boldRGB(255, 255, 0),
     m_disabledRGB(170, 170, 170),
@@ -67,6 +62,39 @@ Boxworld::Boxworld(bool fitToScreen)
     m_backgroundRGB(31, 47, 63),
     m_fitToScreen{fitToScreen}
 {
+    addTile(EMPTY, c_emptyImage);
+    addTile(PASSAGE, c_passageImage);
+    addTile(BOX, c_boxImage);
+    addTile(PLAYER, c_playerImage, 2);
+    addTile(WALL, c_wallImage);
+    addTile(PASSAGE_WITH_TARGET, c_passageWithTargetImage);
+    addTile(BOX_ON_TARGET, c_boxOnTargetImage);
+    addTile(PLAYER_ON_TARGER, c_playerOnTargetImage, 2);
+
+    // everything else drawn (the canvas and text) is reported as damage too
+
+    m_tileMap.setReportDamage(true);
+}
+
+//-------------------------------------------------------------------------
+
+void
+Boxworld::addTile(
+    Pieces piece,
+    std::span<const uint16_t> image,
+    int frames)
+{
+    // the frames of an animated tile are stacked vertically in the image,
+    // and are added to the atlas one after another
+
+    const auto frameSize = c_tileWidth * c_tileHeight;
+
+    m_tileSprites[piece] = Tile{m_tiles.size(), frames};
+
+    for (auto frame = 0 ; frame < frames ; ++frame)
+    {
+        m_tiles.add(c_tileDimensions, image.subspan(frame * frameSize, frameSize));
+    }
 }
 
 //-------------------------------------------------------------------------
@@ -167,34 +195,38 @@ Boxworld::draw(
     Interface565Base& fb,
     Interface565Font& font)
 {
-    m_image.clear(m_backgroundRGB);
-    drawBoard(m_image);
-    drawText(m_image, font);
-
-    const auto id = m_image.getDimensions();
     const auto fbd =  fb.getDimensions();
+    const auto cd = c_canvasDimensions;
+
+    const auto scale = std::min(fbd.width() / cd.width(), fbd.height() / cd.height());
+    const auto zoom = ((scale > 1) and m_fitToScreen) ? scale : 1;
 
-    const auto zoom = std::min(fbd.width() / id.width(), fbd.height() / id.height());
+    const Dimensions565 d{cd.width() * zoom, cd.height() * zoom};
+    const Rectangle565 canvas{Point565{(fbd.width() - d.width()) / 2,
+                                       (fbd.height() - d.height()) / 2},
+                              d};
 
-    if ((zoom > 1) and m_fitToScreen)
+    if (canvas != m_canvas)
     {
-        auto zoomed = scaleUp(m_image, zoom);
-        const auto zd = zoomed.getDimensions();
+        // the first draw, or the screen has changed, so draw everything
 
-        const int xOffset = (fbd.width() - zd.width()) / 2;
-        const int yOffset = (fbd.height() - zd.height()) / 2;
+        m_canvas = canvas;
 
-        const Point565 p{ xOffset, yOffset };
-        fb.putImage(p, zoomed);
-    }
-    else
-    {
-        const int xOffset = (fbd.width() - id.width()) / 2;
-        const int yOffset = (fbd.height() - id.height()) / 2;
+        boxFilled(fb,
+                  canvas.topLeft(),
+                  Point565{canvas.right(), canvas.bottom()},
+                  m_backgroundRGB);
+        fb.addDamage(canvas);
 
-        const Point565 p{ xOffset, yOffset };
-        fb.putImage(p, m_image);
+        m_tileMap.setZoom(zoom);
+        m_tileMap.setOrigin(Point565{canvas.left() + (c_boardPosition.x() * zoom),
+                                     canvas.top() + (c_boardPosition.y() * zoom)});
+        m_tileMap.invalidate();
+        m_textDrawn.reset();
     }
+
+    drawBoard(fb);
+    drawText(fb, font);
 }
 
 //-------------------------------------------------------------------------
@@ -202,31 +234,25 @@ Boxworld::draw(
 void
 Boxworld::drawBoard(Interface565Base& fb)
 {
-    const int xOffset = 40;
-    const int yOffset = 11;
     static uint8_t frame = 0;
 
     for (int j = 0 ; j < Level::c_levelHeight ; ++j)
     {
         for (int i = 0 ; i < Level::c_levelWidth ; ++i)
         {
-            const auto piece = m_board[j][i];
-            auto& tile = m_tileBuffers[piece];
-
-            if (tile.getNumberOfFrames() > 1)
-            {
-                tile.setFrame(frame / 2);
-            }
+            const auto& tile = m_tileSprites[m_board[j][i]];
+            const auto sprite = (tile.frames > 1)
+                              ? tile.sprite + (frame / 2)
+                              : tile.sprite;
 
-            fb.putImage(
-                Point565{
-                    (i * c_tileWidth) + xOffset,
-                    (j * c_tileHeight) + yOffset
-                },
-                tile);
+            m_tileMap.setTile(Point565{i, j}, sprite);
         }
     }
 
+    // only the tiles that changed since the last draw are drawn again
+
+    m_tileMap.draw(fb, m_tiles);
+
     if (frame < 3)
     {
         ++frame;
@@ -244,6 +270,15 @@ Boxworld::drawText(
     Interface565Base& fb,
     Interface565Font& font)
 {
+    const TextState state{m_level, m_levelSolved, m_canUndo};
+
+    if (m_textDrawn == state)
+    {
+        return;
+    }
+
+    m_textDrawn = state;
+
     m_topTextImage.clear(m_backgroundRGB);
 
     Point565 position{ 2, 0 };
@@ -264,7 +299,7 @@ Boxworld::drawText(
                                    m_topTextImage);
     }
 
-    fb.putImage(Point565{ 0, 1 }, m_topTextImage);
+    drawTextImage(fb, Point565{ 0, 1 }, m_topTextImage);
 
     //---------------------------------------------------------------------
 
@@ -323,7 +358,32 @@ Boxworld::drawText(
                                previousRGB,
                                m_bottomTextImage);
 
-    fb.putImage(Point565{0, 223}, m_bottomTextImage);
+    drawTextImage(fb, Point565{0, 223}, m_bottomTextImage);
+}
+
+//-------------------------------------------------------------------------
+
+void
+Boxworld::drawTextImage(
+    Interface565Base& fb,
+    Point565 p,
+    const Image565& image)
+{
+    const auto zoom = m_tileMap.getZoom();
+    const Point565 position{m_canvas.left() + (p.x() * zoom),
+                            m_canvas.top() + (p.y() * zoom)};
+
+    if (zoom > 1)
+    {
+        scaleUpTo(image, fb, position, static_cast<uint8_t>(zoom));
+    }
+    else
+    {
+        fb.putImage(position, image);
+    }
+
+    const auto d = image.getDimensions();
+    fb.addDamage(Rectangle565{position, Dimensions565{d.width() * zoom, d.height() * zoom}});
 }
 
 //-------------------------------------------------------------------------
@@ -29,10 +29,15 @@
 
 //-------------------------------------------------------------------------
 
+#include <array>
+#include <optional>
+#include <span>
+
 #include "image565.h"
-#include "image565Frames.h"
 #include "interface565Font.h"
 #include "joystick.h"
+#include "spriteAtlas565.h"
+#include "tileMap565.h"
 
 #include "images.h"
 #include "level.h"
@@ -71,6 +76,12 @@ public:
     static constexpr int c_boardYoffset{10};
     static constexpr int c_boardYend{c_boardYoffset + (c_tileHeight * Level::c_levelHeight)};
 
+    // everything is laid out on a 320x240 canvas, which is zoomed to fit
+    // the screen and centred on it
+
+    static constexpr fb16::Dimensions565 c_canvasDimensions{320, 240};
+    static constexpr fb16::Point565 c_boardPosition{40, 11};
+
     //---------------------------------------------------------------------
 
     explicit Boxworld(bool fitToScreen);
@@ -82,12 +93,16 @@ public:
 
 private:
 
+    void addTile(Pieces piece, std::span<const uint16_t> image, int frames = 1);
     void findPlayer();
     void swapPieces(const Location& location1, const Location& location2);
     void isLevelSolved();
     void drawBoard(fb16::Interface565Base& fb);
     void drawText(fb16::Interface565Base& fb,
                   fb16::Interface565Font& font);
+    void drawTextImage(fb16::Interface565Base& fb,
+                       fb16::Point565 p,
+                       const fb16::Image565& image);
 
     //---------------------------------------------------------------------
 
@@ -100,10 +115,30 @@ private:
     Level::LevelType m_boardPrevious;
     const Levels m_levels;
 
-    std::array<fb16::Image565Frames, c_tileCount> m_tileBuffers;
+    struct Tile
+    {
+        fb16::SpriteAtlas565::SpriteId sprite;
+        int frames;
+    };
+
+    // the text is only drawn again when something it shows changes
+
+    struct TextState
+    {
+        int level;
+        bool levelSolved;
+        bool canUndo;
+
+        friend bool operator==(const TextState&, const TextState&) = default;
+    };
+
+    fb16::SpriteAtlas565 m_tiles;
+    std::array<Tile, c_tileCount> m_tileSprites;
+    fb16::TileMap565 m_tileMap;
+    fb16::Rectangle565 m_canvas;
+    std::optional<TextState> m_textDrawn;
     fb16::Image565 m_topTextImage;
     fb16::Image565 m_bottomTextImage;
-    fb16::Image565 m_image;
 
     fb16::RGB565 m_textRGB;
     fb16::RGB565 m_boldRGB;
@@ -192,6 +192,7 @@ main(
         Boxworld boxworld{fitToScreen};
         boxworld.init();
         boxworld.draw(*fb, font);
+        fb->update();
 
         //-----------------------------------------------------------------
 
@@ -28,9 +28,11 @@
 #include <getopt.h>
 #include <libgen.h>
 
+#include <cstdlib>
 #include <deque>
 #include <iostream>
 #include <print>
+#include <string>
 #include <system_error>
 
 #include "image565.h"
@@ -52,9 +54,13 @@ printUsage(
     std::println(stream, "");
     std::println(stream, "Usage: {}", name);
     std::println(stream, "");
+    std::println(stream, "    --bold,-b - embolden the text");
     std::println(stream, "    --device,-d - device to use");
     std::println(stream, "    --help,-h - print usage and exit");
     std::println(stream, "    --kmsdrm,-k - use KMS/DRM dumb buffer");
+    std::println(stream, "    --scale,-s - scale the font up (1 to {})",
+                 BitmapGlyphs565::c_maximumScale);
+    std::println(stream, "    --smooth,-m - smooth the scaled font");
     std::println(stream, "");
 }
 
@@ -68,15 +74,19 @@ main(
     std::string device{};
     const std::string program{basename(argv[0])};
     auto interfaceType{fb16::InterfaceType565::FRAME_BUFFER_565};
+    BitmapFontStyle565 style{};
 
     //---------------------------------------------------------------------
 
-    static const char* sopts = "d:hk";
+    static const char* sopts = "bd:hkms:";
     static option lopts[] =
     {
+        { "bold", no_argument, nullptr, 'b' },
         { "device", required_argument, nullptr, 'd' },
         { "help", no_argument, nullptr, 'h' },
         { "kmsdrm", no_argument, nullptr, 'k' },
+        { "scale", required_argument, nullptr, 's' },
+        { "smooth", no_argument, nullptr, 'm' },
         { nullptr, no_argument, nullptr, 0 }
     };
 
@@ -86,6 +96,12 @@ main(
     {
         switch (opt)
         {
+        case 'b':
+
+            style.m_bold = true;
+
+            break;
+
         case 'd':
 
             device = optarg;
@@ -105,6 +121,18 @@ main(
 
             break;
 
+        case 'm':
+
+            style.m_smooth = true;
+
+            break;
+
+        case 's':
+
+            style.m_scale = std::atoi(optarg);
+
+            break;
+
         default:
 
             printUsage(std::cerr, program);
@@ -118,7 +146,7 @@ main(
 
     try
     {
-        Image565Font8x16 font;
+        Image565Font8x16 font{style};
         constexpr RGB565 black{0, 0, 0};
         constexpr RGB565 white{255, 255, 255};
         auto fb{fb16::createInterface565(interfaceType, device)};
@@ -148,12 +176,17 @@ main(
 
             int y = 0;
 
+            // each line is padded to the full width and drawn with an
+            // opaque background, so the text that scrolled off is
+            // overwritten without clearing the image first
+
             for (const auto& l : lines)
             {
                 font.drawString(
                     Point565{0, y},
-                    l,
+                    l + std::string(columns - l.size(), ' '),
                     white,
+                    black,
                     image);
 
                 y += ftd.height();
@@ -0,0 +1,557 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <getopt.h>
+#include <libgen.h>
+
+#include <ft2build.h>
+#include <freetype/freetype.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <print>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "tokenize.h"
+
+//-------------------------------------------------------------------------
+
+// Rasterise a TrueType (or any FreeType) font at one or more pixel sizes
+// and write it as a header of constexpr BakedFont565 data, which
+// Image565FontBaked draws without FreeType.
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+struct Glyph
+{
+    char32_t code;
+    int left;
+    int top;
+    int width;
+    int rows;
+    int advance;
+    std::size_t offset;
+};
+
+//-------------------------------------------------------------------------
+
+struct Kerning
+{
+    char32_t left;
+    char32_t right;
+    int kerning;
+};
+
+//-------------------------------------------------------------------------
+
+void
+printUsage(
+    std::ostream& stream,
+    const std::string& name)
+{
+    std::println(stream, "");
+    std::println(stream, "Usage: {} --font <file> [options]", name);
+    std::println(stream, "");
+    std::println(stream, "    --characters,-c - code points to bake (default 32-126,160-255)");
+    std::println(stream, "    --font,-f - font file to bake");
+    std::println(stream, "    --help,-h - print usage and exit");
+    std::println(stream, "    --name,-n - name of the data (default from the font file)");
+    std::println(stream, "    --output,-o - header to write (default stdout)");
+    std::println(stream, "    --size,-s - pixel size, may be repeated (default 16)");
+    std::println(stream, "");
+}
+
+//-------------------------------------------------------------------------
+
+// "32-126,160-255" to a list of code points.
+
+std::vector<char32_t>
+parseCharacters(
+    std::string_view ranges)
+{
+    std::vector<char32_t> characters;
+
+    for (const auto range : fb16::tokenize(ranges, [](char c) { return c == ','; }))
+    {
+        if (range.empty())
+        {
+            continue;
+        }
+
+        const std::string text{range};
+        const auto dash = text.find('-');
+        const auto first = std::stoul(text.substr(0, dash), nullptr, 0);
+        const auto last = (dash == std::string::npos)
+                        ? first
+                        : std::stoul(text.substr(dash + 1), nullptr, 0);
+
+        for (auto c = first ; c <= last ; ++c)
+        {
+            characters.push_back(static_cast<char32_t>(c));
+        }
+    }
+
+    std::ranges::sort(characters);
+    const auto [first, last] = std::ranges::unique(characters);
+    characters.erase(first, last);
+
+    return characters;
+}
+
+//-------------------------------------------------------------------------
+
+// An identifier from the font file name, "Lato-Regular.ttf" to
+// "latoRegular".
+
+std::string
+nameFromFile(
+    const std::string& fontFile)
+{
+    std::string name;
+    bool upper{false};
+
+    for (const auto c : std::filesystem::path(fontFile).stem().string())
+    {
+        if (std::isalnum(static_cast<unsigned char>(c)))
+        {
+            name += (upper) ? std::toupper(c) : ((name.empty()) ? std::tolower(c) : c);
+            upper = false;
+        }
+        else
+        {
+            upper = not name.empty();
+        }
+    }
+
+    if (name.empty() or std::isdigit(static_cast<unsigned char>(name.front())))
+    {
+        name = "font" + name;
+    }
+
+    return name;
+}
+
+//-------------------------------------------------------------------------
+
+// A C++ string literal for a name from the font, which may be missing or
+// hold quotes, backslashes or control characters. Octal escapes are used
+// as they end after three digits, whatever follows.
+
+std::string
+stringLiteral(
+    const char* name)
+{
+    std::string literal{"\""};
+
+    for (const auto c : std::string_view{(name) ? name : ""})
+    {
+        const auto byte = static_cast<unsigned char>(c);
+
+        if ((c == '"') or (c == '\\'))
+        {
+            literal += '\\';
+            literal += c;
+        }
+        else if ((byte < 0x20) or (byte == 0x7F))
+        {
+            literal += std::format("\\{:03o}", byte);
+        }
+        else
+        {
+            literal += c;
+        }
+    }
+
+    literal += '"';
+
+    return literal;
+}
+
+//-------------------------------------------------------------------------
+
+void
+bake(
+    std::ostream& stream,
+    FT_Face face,
+    const std::string& name,
+    int pixelSize,
+    const std::vector<char32_t>& characters)
+{
+    if (FT_Set_Pixel_Sizes(face, 0, pixelSize) != 0)
+    {
+        throw std::invalid_argument("FreeType could not set pixel size " +
+                                    std::to_string(pixelSize));
+    }
+
+    const auto& metrics = face->size->metrics;
+    const int ascender = metrics.ascender >> 6;
+    const int height = (metrics.ascender + std::abs(metrics.descender)) >> 6;
+    const int maxAdvance = metrics.max_advance >> 6;
+
+    std::vector<Glyph> glyphs;
+    std::vector<FT_UInt> indices;
+    std::vector<uint8_t> coverage;
+
+    for (const auto c : characters)
+    {
+        const auto index = FT_Get_Char_Index(face, c);
+
+        if ((index == 0) or (FT_Load_Glyph(face, index, FT_LOAD_RENDER) != 0))
+        {
+            continue;
+        }
+
+        const auto slot{face->glyph};
+        const auto& bitmap{slot->bitmap};
+        const int width = bitmap.width;
+        const int rows = bitmap.rows;
+
+        glyphs.push_back(Glyph{c,
+                               slot->bitmap_left,
+                               slot->bitmap_top,
+                               width,
+                               rows,
+                               static_cast<int>(slot->advance.x >> 6),
+                               coverage.size()});
+        indices.push_back(index);
+
+        // four bits a pixel, left pixel in the high nibble, rows on
+        // whole bytes
+
+        for (int j = 0 ; j < rows ; ++j)
+        {
+            const auto* row{bitmap.buffer + (j * bitmap.pitch)};
+
+            for (int i = 0 ; i < width ; i += 2)
+            {
+                const auto quantise = [](int value)
+                {
+                    return static_cast<uint8_t>(((value * 15) + 127) / 255);
+                };
+
+                const auto high = quantise(row[i]);
+                const auto low = (i + 1 < width) ? quantise(row[i + 1]) : uint8_t{0};
+
+                coverage.push_back(static_cast<uint8_t>((high << 4) | low));
+            }
+        }
+    }
+
+    std::vector<Kerning> kerning;
+
+    if (FT_HAS_KERNING(face))
+    {
+        for (std::size_t l = 0 ; l < glyphs.size() ; ++l)
+        {
+            for (std::size_t r = 0 ; r < glyphs.size() ; ++r)
+            {
+                FT_Vector delta{};
+
+                FT_Get_Kerning(face, indices[l], indices[r], ft_kerning_default, &delta);
+
+                if ((delta.x >> 6) != 0)
+                {
+                    kerning.push_back(Kerning{glyphs[l].code,
+                                              glyphs[r].code,
+                                              static_cast<int>(delta.x >> 6)});
+                }
+            }
+        }
+    }
+
+    //---------------------------------------------------------------------
+
+    const auto fontName = name + std::to_string(pixelSize);
+
+    std::println(stream, "inline constexpr std::array<uint8_t, {}> c_{}Coverage", coverage.size(), fontName);
+    std::println(stream, "{{");
+
+    for (std::size_t i = 0 ; i < coverage.size() ; i += 12)
+    {
+        std::print(stream, "   ");
+
+        for (std::size_t j = i ; j < std::min(i + 12, coverage.size()) ; ++j)
+        {
+            std::print(stream, " 0x{:02X},", coverage[j]);
+        }
+
+        std::println(stream, "");
+    }
+
+    std::println(stream, "}};");
+    std::println(stream, "");
+
+    std::println(stream, "inline constexpr std::array<BakedGlyph565, {}> c_{}Glyphs", glyphs.size(), fontName);
+    std::println(stream, "{{{{");
+
+    for (const auto& glyph : glyphs)
+    {
+        std::println(stream,
+                     "    {{ 0x{:04X}, {}, {}, {}, {}, {}, {} }},",
+                     static_cast<uint32_t>(glyph.code),
+                     glyph.left,
+                     glyph.top,
+                     glyph.width,
+                     glyph.rows,
+                     glyph.advance,
+                     glyph.offset);
+    }
+
+    std::println(stream, "}}}};");
+    std::println(stream, "");
+
+    std::println(stream, "inline constexpr std::array<BakedKerning565, {}> c_{}Kerning", kerning.size(), fontName);
+    std::println(stream, "{{{{");
+
+    for (const auto& pair : kerning)
+    {
+        std::println(stream,
+                     "    {{ 0x{:04X}, 0x{:04X}, {} }},",
+                     static_cast<uint32_t>(pair.left),
+                     static_cast<uint32_t>(pair.right),
+                     pair.kerning);
+    }
+
+    std::println(stream, "}}}};");
+    std::println(stream, "");
+
+    std::println(stream, "inline constexpr BakedFont565 c_{}", fontName);
+    std::println(stream, "{{");
+    std::println(stream, "    {},", stringLiteral(face->family_name));
+    std::println(stream, "    {},", stringLiteral(face->style_name));
+    std::println(stream, "    {},", pixelSize);
+    std::println(stream, "    {},", ascender);
+    std::println(stream, "    {},", height - ascender);
+    std::println(stream, "    {},", maxAdvance);
+    std::println(stream, "    c_{}Glyphs,", fontName);
+    std::println(stream, "    c_{}Kerning,", fontName);
+    std::println(stream, "    c_{}Coverage", fontName);
+    std::println(stream, "}};");
+    std::println(stream, "");
+    std::println(stream, "//-------------------------------------------------------------------------");
+    std::println(stream, "");
+}
+
+//-------------------------------------------------------------------------
+
+} // namespace
+
+//-------------------------------------------------------------------------
+
+int
+main(
+    int argc,
+    char *argv[])
+{
+    const std::string program{basename(argv[0])};
+    std::string fontFile{};
+    std::string name{};
+    std::string output{};
+    std::string characters{"32-126,160-255"};
+    std::vector<int> sizes{};
+
+    //---------------------------------------------------------------------
+
+    static const char* sopts = "c:f:hn:o:s:";
+    static option lopts[] =
+    {
+        { "characters", required_argument, nullptr, 'c' },
+        { "font", required_argument, nullptr, 'f' },
+        { "help", no_argument, nullptr, 'h' },
+        { "name", required_argument, nullptr, 'n' },
+        { "output", required_argument, nullptr, 'o' },
+        { "size", required_argument, nullptr, 's' },
+        { nullptr, no_argument, nullptr, 0 }
+    };
+
+    int opt{};
+
+    while ((opt = ::getopt_long(argc, argv, sopts, lopts, nullptr)) != -1)
+    {
+        switch (opt)
+        {
+        case 'c':
+
+            characters = optarg;
+            break;
+
+        case 'f':
+
+            fontFile = optarg;
+            break;
+
+        case 'h':
+
+            printUsage(std::cout, program);
+            ::exit(EXIT_SUCCESS);
+            break;
+
+        case 'n':
+
+            name = optarg;
+            break;
+
+        case 'o':
+
+            output = optarg;
+            break;
+
+        case 's':
+
+            sizes.push_back(std::atoi(optarg));
+            break;
+
+        default:
+
+            printUsage(std::cerr, program);
+            ::exit(EXIT_FAILURE);
+            break;
+        }
+    }
+
+    //---------------------------------------------------------------------
+
+    if (fontFile.empty())
+    {
+        std::println(std::cerr, "Error: Font file must be specfied");
+        printUsage(std::cerr, program);
+        ::exit(EXIT_FAILURE);
+    }
+
+    if (sizes.empty())
+    {
+        sizes.push_back(16);
+    }
+
+    if (name.empty())
+    {
+        name = nameFromFile(fontFile);
+    }
+
+    //---------------------------------------------------------------------
+
+    FT_Library library{};
+    FT_Face face{};
+
+    try
+    {
+        const auto codes = parseCharacters(characters);
+
+        if (FT_Init_FreeType(&library) != 0)
+        {
+            throw std::invalid_argument("FreeType initialization failed");
+        }
+
+        if (FT_New_Face(library, fontFile.c_str(), 0, &face) != 0)
+        {
+            throw std::invalid_argument("FreeType could not open " + fontFile);
+        }
+
+        std::ofstream file;
+
+        if (not output.empty())
+        {
+            file.open(output);
+
+            if (not file)
+            {
+                throw std::invalid_argument("could not write " + output);
+            }
+        }
+
+        std::ostream& stream = (output.empty()) ? std::cout : file;
+
+        std::println(stream, "//-------------------------------------------------------------------------");
+        std::println(stream, "//");
+        std::println(stream, "// Generated by fontbake from {}. Do not edit.",
+                     std::filesystem::path(fontFile).filename().string());
+        std::println(stream, "//");
+        std::println(stream, "//-------------------------------------------------------------------------");
+        std::println(stream, "");
+        std::println(stream, "#pragma once");
+        std::println(stream, "");
+        std::println(stream, "//-------------------------------------------------------------------------");
+        std::println(stream, "");
+        std::println(stream, "#include <array>");
+        std::println(stream, "#include <cstdint>");
+        std::println(stream, "");
+        std::println(stream, "#include \"bakedFont565.h\"");
+        std::println(stream, "");
+        std::println(stream, "//-------------------------------------------------------------------------");
+        std::println(stream, "");
+        std::println(stream, "namespace fb16");
+        std::println(stream, "{{");
+        std::println(stream, "");
+        std::println(stream, "//-------------------------------------------------------------------------");
+        std::println(stream, "");
+
+        for (const auto size : sizes)
+        {
+            bake(stream, face, name, size, codes);
+        }
+
+        std::println(stream, "inline constexpr std::array<const BakedFont565*, {}> c_{}Sizes", sizes.size(), name);
+        std::println(stream, "{{");
+
+        for (const auto size : sizes)
+        {
+            std::println(stream, "    &c_{}{},", name, size);
+        }
+
+        std::println(stream, "}};");
+        std::println(stream, "");
+        std::println(stream, "//-------------------------------------------------------------------------");
+        std::println(stream, "");
+
+        std::println(stream, "}} // namespace fb16");
+        std::println(stream, "");
+        std::println(stream, "//-------------------------------------------------------------------------");
+        std::println(stream, "");
+    }
+    catch (std::exception& error)
+    {
+        std::println(std::cerr, "Error: {}", error.what());
+        FT_Done_FreeType(library);
+        ::exit(EXIT_FAILURE);
+    }
+
+    FT_Done_FreeType(library);
+}
@@ -0,0 +1,90 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+//-------------------------------------------------------------------------
+
+namespace fb16
+{
+
+//-------------------------------------------------------------------------
+
+// A font rasterised ahead of time by fontbake, for Image565FontBaked. The
+// tool writes one of these, and the arrays it points at, as constexpr data
+// in a header, so drawing needs no FreeType at run time.
+//
+// Coverage is four bits a pixel, two pixels a byte with the left one in
+// the high nibble, and each row of a glyph starts on a whole byte.
+
+struct BakedGlyph565
+{
+    char32_t m_code;
+    int16_t m_left;
+    int16_t m_top;
+    uint16_t m_width;
+    uint16_t m_rows;
+    int16_t m_advance;
+    uint32_t m_offset;
+};
+
+struct BakedKerning565
+{
+    char32_t m_left;
+    char32_t m_right;
+    int16_t m_kerning;
+};
+
+struct BakedFont565
+{
+    std::string_view m_familyName;
+    std::string_view m_styleName;
+    int m_pixelSize;
+    int m_ascender;
+    int m_descender;
+    int m_maxAdvance;
+
+    // sorted by code, and by left then right code
+
+    std::span<const BakedGlyph565> m_glyphs;
+    std::span<const BakedKerning565> m_kerning;
+    std::span<const uint8_t> m_coverage;
+};
+
+//-------------------------------------------------------------------------
+
+} // namespace fb16
+
+//-------------------------------------------------------------------------
+
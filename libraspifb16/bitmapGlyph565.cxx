@@ -0,0 +1,512 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+
+#include "bitmapGlyph565.h"
+#include "interface565Base.h"
+
+//=========================================================================
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+using namespace fb16;
+
+//-------------------------------------------------------------------------
+
+constexpr int c_glyphWidth{8};
+constexpr std::size_t c_glyphs{256};
+
+using Masks = std::array<uint16_t, c_glyphWidth>;
+
+// For each byte, a mask of all ones for each set bit, left most pixel
+// (top bit) first.
+
+constexpr auto c_masks = []
+{
+    std::array<Masks, 256> masks{};
+
+    for (std::size_t byte = 0 ; byte < masks.size() ; ++byte)
+    {
+        for (int i = 0 ; i < c_glyphWidth ; ++i)
+        {
+            masks[byte][i] = ((byte >> (c_glyphWidth - i - 1)) & 1) ? 0xFFFF : 0;
+        }
+    }
+
+    return masks;
+}();
+
+//-------------------------------------------------------------------------
+
+// Draw a glyph of rows of bytesPerRow bytes, each byte eight pixels.
+// Native glyphs, of one byte per row, have it fixed at compile time.
+
+template<bool opaque, int fixedBytesPerRow = 0>
+void
+drawGlyph(
+    Interface565Base& image,
+    const Point565 p,
+    std::span<const uint8_t> rows,
+    int bytesPerRow,
+    uint16_t foreground,
+    uint16_t background)
+{
+    if constexpr (fixedBytesPerRow > 0)
+    {
+        bytesPerRow = fixedBytesPerRow;
+    }
+
+    const auto glyphWidth = c_glyphWidth * bytesPerRow;
+    const auto glyphHeight = static_cast<int>(rows.size()) / bytesPerRow;
+    const Rectangle565 cell{p, Dimensions565{glyphWidth, glyphHeight}};
+    const auto visible = image.getClip().intersection(cell);
+
+    if (visible.empty())
+    {
+        return;
+    }
+
+    const auto xStart = visible.left() - p.x();
+    const auto width = static_cast<std::size_t>(visible.width());
+
+    for (int y = visible.top() ; y <= visible.bottom() ; ++y)
+    {
+        const auto* row{rows.data() + ((y - p.y()) * bytesPerRow)};
+
+        if constexpr (not opaque)
+        {
+            if (std::all_of(row, row + bytesPerRow, [](uint8_t byte) { return byte == 0; }))
+            {
+                continue;
+            }
+        }
+
+        auto pixels = image.getRow(y).subspan(visible.left(), width);
+
+        if (static_cast<int>(width) == glyphWidth)
+        {
+            for (int byte = 0 ; byte < bytesPerRow ; ++byte)
+            {
+                if constexpr (not opaque)
+                {
+                    if (row[byte] == 0)
+                    {
+                        continue;
+                    }
+                }
+
+                // eight pixels, which the compiler turns into a single
+                // vector select
+
+                const auto& masks = c_masks[row[byte]];
+                auto* eight{pixels.data() + (byte * c_glyphWidth)};
+
+                for (int i = 0 ; i < c_glyphWidth ; ++i)
+                {
+                    const uint16_t under = (opaque) ? background : eight[i];
+                    eight[i] = (foreground & masks[i]) | (under & ~masks[i]);
+                }
+            }
+        }
+        else
+        {
+            for (std::size_t i = 0 ; i < width ; ++i)
+            {
+                const auto x = xStart + i;
+                const auto mask = c_masks[row[x / c_glyphWidth]][x % c_glyphWidth];
+                const uint16_t under = (opaque) ? background : pixels[i];
+                pixels[i] = (foreground & mask) | (under & ~mask);
+            }
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
+// A glyph as one byte (0 or 1) per pixel, while it is being styled.
+
+class Grid
+{
+public:
+
+    Grid(
+        int width,
+        int height)
+    :
+        m_width{width},
+        m_height{height},
+        m_pixels(width * height)
+    {
+    }
+
+    [[nodiscard]] int width() const noexcept { return m_width; }
+    [[nodiscard]] int height() const noexcept { return m_height; }
+
+    // Outside the grid is the nearest pixel inside it, as scale2x and
+    // scale3x expect.
+
+    [[nodiscard]] uint8_t
+    at(
+        int x,
+        int y) const noexcept
+    {
+        x = std::clamp(x, 0, m_width - 1);
+        y = std::clamp(y, 0, m_height - 1);
+
+        return m_pixels[x + (y * m_width)];
+    }
+
+    void
+    set(
+        int x,
+        int y,
+        uint8_t value) noexcept
+    {
+        m_pixels[x + (y * m_width)] = value;
+    }
+
+private:
+
+    int m_width;
+    int m_height;
+    std::vector<uint8_t> m_pixels;
+};
+
+//-------------------------------------------------------------------------
+
+Grid
+scaleNearest(
+    const Grid& in,
+    int scale)
+{
+    Grid out{in.width() * scale, in.height() * scale};
+
+    for (int y = 0 ; y < out.height() ; ++y)
+    {
+        for (int x = 0 ; x < out.width() ; ++x)
+        {
+            out.set(x, y, in.at(x / scale, y / scale));
+        }
+    }
+
+    return out;
+}
+
+//-------------------------------------------------------------------------
+
+Grid
+scale2x(
+    const Grid& in)
+{
+    Grid out{in.width() * 2, in.height() * 2};
+
+    for (int y = 0 ; y < in.height() ; ++y)
+    {
+        for (int x = 0 ; x < in.width() ; ++x)
+        {
+            const auto a = in.at(x, y - 1);
+            const auto b = in.at(x + 1, y);
+            const auto c = in.at(x - 1, y);
+            const auto d = in.at(x, y + 1);
+            const auto p = in.at(x, y);
+
+            out.set(2 * x, 2 * y, ((c == a) and (c != d) and (a != b)) ? a : p);
+            out.set(2 * x + 1, 2 * y, ((a == b) and (a != c) and (b != d)) ? b : p);
+            out.set(2 * x, 2 * y + 1, ((d == c) and (d != b) and (c != a)) ? c : p);
+            out.set(2 * x + 1, 2 * y + 1, ((b == d) and (b != a) and (d != c)) ? d : p);
+        }
+    }
+
+    return out;
+}
+
+//-------------------------------------------------------------------------
+
+Grid
+scale3x(
+    const Grid& in)
+{
+    Grid out{in.width() * 3, in.height() * 3};
+
+    for (int y = 0 ; y < in.height() ; ++y)
+    {
+        for (int x = 0 ; x < in.width() ; ++x)
+        {
+            const auto a = in.at(x - 1, y - 1);
+            const auto b = in.at(x, y - 1);
+            const auto c = in.at(x + 1, y - 1);
+            const auto d = in.at(x - 1, y);
+            const auto e = in.at(x, y);
+            const auto f = in.at(x + 1, y);
+            const auto g = in.at(x - 1, y + 1);
+            const auto h = in.at(x, y + 1);
+            const auto i = in.at(x + 1, y + 1);
+
+            const bool db = (d == b) and (b != f) and (d != h);
+            const bool bf = (b == f) and (b != d) and (f != h);
+            const bool dh = (d == h) and (d != b) and (h != f);
+            const bool hf = (h == f) and (d != h) and (b != f);
+
+            const int x3 = x * 3;
+            const int y3 = y * 3;
+
+            out.set(x3, y3, (db) ? d : e);
+            out.set(x3 + 1, y3, ((db and (e != c)) or (bf and (e != a))) ? b : e);
+            out.set(x3 + 2, y3, (bf) ? f : e);
+            out.set(x3, y3 + 1, ((db and (e != g)) or (dh and (e != a))) ? d : e);
+            out.set(x3 + 1, y3 + 1, e);
+            out.set(x3 + 2, y3 + 1, ((bf and (e != i)) or (hf and (e != c))) ? f : e);
+            out.set(x3, y3 + 2, (dh) ? d : e);
+            out.set(x3 + 1, y3 + 2, ((dh and (e != i)) or (hf and (e != g))) ? h : e);
+            out.set(x3 + 2, y3 + 2, (hf) ? f : e);
+        }
+    }
+
+    return out;
+}
+
+//-------------------------------------------------------------------------
+
+// The row to underline: the lowest row of the font's own underscore, or
+// the bottom row if it has none.
+
+int
+underlineRow(
+    std::span<const uint8_t> font,
+    int height) noexcept
+{
+    const auto underscore = font.subspan('_' * height, height);
+
+    for (int j = height - 1 ; j >= 0 ; --j)
+    {
+        if (underscore[j] != 0)
+        {
+            return j;
+        }
+    }
+
+    return height - 1;
+}
+
+//-------------------------------------------------------------------------
+
+} // namespace
+
+//=========================================================================
+
+void
+fb16::drawBitmapGlyph(
+    Interface565Base& image,
+    const Point565 p,
+    std::span<const uint8_t> rows,
+    uint16_t foreground)
+{
+    drawGlyph<false, 1>(image, p, rows, 1, foreground, 0);
+}
+
+//-------------------------------------------------------------------------
+
+void
+fb16::drawBitmapGlyph(
+    Interface565Base& image,
+    const Point565 p,
+    std::span<const uint8_t> rows,
+    uint16_t foreground,
+    uint16_t background)
+{
+    drawGlyph<true, 1>(image, p, rows, 1, foreground, background);
+}
+
+//=========================================================================
+
+fb16::BitmapGlyphs565::BitmapGlyphs565(
+    std::span<const uint8_t> font,
+    int height,
+    const BitmapFontStyle565& style)
+:
+    m_style{style},
+    m_dimensions{c_glyphWidth * style.m_scale, height * style.m_scale},
+    m_bytesPerRow{style.m_scale},
+    m_font{font},
+    m_expanded{}
+{
+    if ((style.m_scale < 1) or (style.m_scale > c_maximumScale))
+    {
+        throw std::invalid_argument("bitmap font scale must be 1 to 8");
+    }
+
+    if ((height < 1) or (font.size() != (c_glyphs * height)))
+    {
+        throw std::invalid_argument("bitmap font must have 256 glyphs");
+    }
+
+    if (style == BitmapFontStyle565{})
+    {
+        return;
+    }
+
+    //---------------------------------------------------------------------
+
+    const auto underline = underlineRow(font, height);
+    const auto glyphBytes = m_dimensions.height() * m_bytesPerRow;
+
+    m_expanded.resize(c_glyphs * glyphBytes);
+
+    for (std::size_t c = 0 ; c < c_glyphs ; ++c)
+    {
+        Grid grid{c_glyphWidth, height};
+
+        for (int j = 0 ; j < height ; ++j)
+        {
+            uint8_t byte = font[(c * height) + j];
+
+            if (style.m_bold)
+            {
+                byte |= byte >> 1;
+            }
+
+            if (style.m_underline and (j == underline))
+            {
+                byte = 0xFF;
+            }
+
+            for (int i = 0 ; i < c_glyphWidth ; ++i)
+            {
+                grid.set(i, j, (byte >> (c_glyphWidth - i - 1)) & 1);
+            }
+        }
+
+        //-----------------------------------------------------------------
+
+        auto scale = style.m_scale;
+
+        while (style.m_smooth and ((scale % 2) == 0))
+        {
+            grid = scale2x(grid);
+            scale /= 2;
+        }
+
+        while (style.m_smooth and ((scale % 3) == 0))
+        {
+            grid = scale3x(grid);
+            scale /= 3;
+        }
+
+        if (scale > 1)
+        {
+            grid = scaleNearest(grid, scale);
+        }
+
+        //-----------------------------------------------------------------
+
+        auto* rows{m_expanded.data() + (c * glyphBytes)};
+
+        for (int y = 0 ; y < grid.height() ; ++y)
+        {
+            for (int x = 0 ; x < grid.width() ; ++x)
+            {
+                if (grid.at(x, y))
+                {
+                    rows[(y * m_bytesPerRow) + (x / c_glyphWidth)] |=
+                        0x80 >> (x % c_glyphWidth);
+                }
+            }
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
+bool
+fb16::BitmapGlyphs565::isSet(
+    uint8_t c,
+    int x,
+    int y) const noexcept
+{
+    const auto byte = getRows(c)[(y * m_bytesPerRow) + (x / c_glyphWidth)];
+
+    return (byte >> (c_glyphWidth - (x % c_glyphWidth) - 1)) & 1;
+}
+
+//-------------------------------------------------------------------------
+
+void
+fb16::BitmapGlyphs565::draw(
+    Interface565Base& image,
+    const Point565 p,
+    uint8_t c,
+    uint16_t foreground) const
+{
+    if (m_bytesPerRow == 1)
+    {
+        drawGlyph<false, 1>(image, p, getRows(c), 1, foreground, 0);
+    }
+    else
+    {
+        drawGlyph<false>(image, p, getRows(c), m_bytesPerRow, foreground, 0);
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+fb16::BitmapGlyphs565::draw(
+    Interface565Base& image,
+    const Point565 p,
+    uint8_t c,
+    uint16_t foreground,
+    uint16_t background) const
+{
+    if (m_bytesPerRow == 1)
+    {
+        drawGlyph<true, 1>(image, p, getRows(c), 1, foreground, background);
+    }
+    else
+    {
+        drawGlyph<true>(image, p, getRows(c), m_bytesPerRow, foreground, background);
+    }
+}
+
+//-------------------------------------------------------------------------
+
+std::span<const uint8_t>
+fb16::BitmapGlyphs565::getRows(
+    uint8_t c) const noexcept
+{
+    const std::size_t glyphBytes = m_dimensions.height() * m_bytesPerRow;
+    const std::span<const uint8_t> glyphs{(m_expanded.empty()) ? m_font : m_expanded};
+
+    return glyphs.subspan(c * glyphBytes, glyphBytes);
+}
+
@@ -0,0 +1,150 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "interface565.h"
+
+//-------------------------------------------------------------------------
+
+namespace fb16
+{
+
+//-------------------------------------------------------------------------
+
+class Interface565Base;
+
+//-------------------------------------------------------------------------
+
+// Draw a glyph eight pixels wide, given as one byte per row with the left
+// most pixel in the top bit, as the bitmap fonts store them. The glyph is
+// clipped once, then each byte is expanded to eight pixel masks from a
+// table and the row is written with a masked select.
+//
+// Only the set bits are drawn in foreground, unless a background is given,
+// in which case every pixel of the cell is written.
+
+void
+drawBitmapGlyph(
+    Interface565Base& image,
+    const Point565 p,
+    std::span<const uint8_t> rows,
+    uint16_t foreground);
+
+void
+drawBitmapGlyph(
+    Interface565Base& image,
+    const Point565 p,
+    std::span<const uint8_t> rows,
+    uint16_t foreground,
+    uint16_t background);
+
+//-------------------------------------------------------------------------
+
+// How to draw a bitmap font: scaled up by a whole number, with bold and
+// underline synthesised from the glyphs. Smoothing scales by scale2x and
+// scale3x (EPX) instead of repeating pixels, for each factor of 2 or 3 in
+// the scale.
+
+struct BitmapFontStyle565
+{
+    int m_scale{1};
+    bool m_smooth{};
+    bool m_bold{};
+    bool m_underline{};
+
+    bool operator==(const BitmapFontStyle565&) const = default;
+};
+
+//-------------------------------------------------------------------------
+
+// The 256 glyphs of a bitmap font, expanded once for a style. Each row of
+// an expanded glyph is stored as a byte for every eight pixels, and drawn
+// with the same mask table and masked select as a native glyph, so large
+// or styled text costs no more per pixel than native text. The native
+// style uses the font's own rows.
+
+class BitmapGlyphs565
+{
+public:
+
+    static constexpr int c_maximumScale{8};
+
+    // font is 256 glyphs of height rows, one byte per row.
+
+    BitmapGlyphs565(
+        std::span<const uint8_t> font,
+        int height,
+        const BitmapFontStyle565& style = {});
+
+    [[nodiscard]] const BitmapFontStyle565& getStyle() const noexcept { return m_style; }
+
+    // The size of a character cell.
+
+    [[nodiscard]] Dimensions565 getDimensions() const noexcept { return m_dimensions; }
+
+    [[nodiscard]] bool isSet(uint8_t c, int x, int y) const noexcept;
+
+    void
+    draw(
+        Interface565Base& image,
+        const Point565 p,
+        uint8_t c,
+        uint16_t foreground) const;
+
+    void
+    draw(
+        Interface565Base& image,
+        const Point565 p,
+        uint8_t c,
+        uint16_t foreground,
+        uint16_t background) const;
+
+private:
+
+    [[nodiscard]] std::span<const uint8_t> getRows(uint8_t c) const noexcept;
+
+    BitmapFontStyle565 m_style;
+    Dimensions565 m_dimensions;
+    int m_bytesPerRow;
+    std::span<const uint8_t> m_font;
+    std::vector<uint8_t> m_expanded;
+};
+
+//-------------------------------------------------------------------------
+
+} // namespace fb16
+
+//-------------------------------------------------------------------------
+
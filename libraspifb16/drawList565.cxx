@@ -0,0 +1,343 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "drawList565.h"
+#include "image565Graphics.h"
+#include "image565View.h"
+
+//-------------------------------------------------------------------------
+
+fb16::DrawList565::DrawList565(
+    int bandHeight)
+:
+    m_bandHeight{bandHeight},
+    m_commands{},
+    m_bounds{},
+    m_bandStart{},
+    m_bandCommands{}
+{
+    if (bandHeight < 1)
+    {
+        throw std::invalid_argument("band height must be at least one row");
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+fb16::DrawList565::box(
+    Point565 p1,
+    Point565 p2,
+    uint16_t rgb)
+{
+    add(Rectangle565{p1, p2}, Box{p1, p2, rgb, false});
+}
+
+//-------------------------------------------------------------------------
+
+void
+fb16::DrawList565::boxFilled(
+    Point565 p1,
+    Point565 p2,
+    uint16_t rgb)
+{
+    add(Rectangle565{p1, p2}, Box{p1, p2, rgb, true});
+}
+
+//-------------------------------------------------------------------------
+
+void
+fb16::DrawList565::boxFilled(
+    Point565 p1,
+    Point565 p2,
+    const RGB565& rgb,
+    uint8_t alpha)
+{
+    add(Rectangle565{p1, p2}, BoxBlend{p1, p2, rgb, alpha});
+}
+
+//-------------------------------------------------------------------------
+
+void
+fb16::DrawList565::line(
+    Point565 p1,
+    Point565 p2,
+    uint16_t rgb)
+{
+    add(Rectangle565{p1, p2}, Line{p1, p2, rgb});
+}
+
+//-------------------------------------------------------------------------
+
+void
+fb16::DrawList565::putImage(
+    Point565 p,
+    const Interface565Base& image)
+{
+    add(Rectangle565{p, image.getDimensions()}, Image{p, &image});
+}
+
+//-------------------------------------------------------------------------
+
+void
+fb16::DrawList565::text(
+    Point565 p,
+    std::string_view sv,
+    uint16_t rgb,
+    Interface565Font& font)
+{
+    // Glyphs can draw outside of the box given by getStringDimensions(),
+    // such as accents above the line or overhanging tails. The bands the
+    // text goes into are found from that box padded by a line all round,
+    // so ink outside of the box is not cut off at the edge of a band.
+
+    const auto d = font.getStringDimensions(sv);
+    const auto pad = d.height();
+
+    add(Rectangle565{Point565{p.x() - pad, p.y() - pad},
+                     Dimensions565{d.width() + (2 * pad), d.height() + (2 * pad)}},
+        Text{p, std::string(sv), rgb, &font});
+}
+
+//-------------------------------------------------------------------------
+
+void
+fb16::DrawList565::clear() noexcept
+{
+    m_commands.clear();
+    m_bounds.clear();
+}
+
+//-------------------------------------------------------------------------
+
+void
+fb16::DrawList565::execute(
+    Interface565Base& target,
+    int threads)
+{
+    const auto clip = target.getClip();
+
+    if (m_commands.empty() or clip.empty())
+    {
+        return;
+    }
+
+    const auto bands = (clip.height() + m_bandHeight - 1) / m_bandHeight;
+
+    //---------------------------------------------------------------------
+    // Counting sort of the commands into the bands they touch. Within a
+    // band the commands stay in the order they were added.
+
+    auto bandRange = [&](const Rectangle565& bounds) -> std::pair<int, int>
+    {
+        const auto visible = clip.intersection(bounds);
+
+        if (visible.empty())
+        {
+            return {1, 0};
+        }
+
+        return {(visible.top() - clip.top()) / m_bandHeight,
+                (visible.bottom() - clip.top()) / m_bandHeight};
+    };
+
+    m_bandStart.assign(bands + 1, 0);
+
+    for (const auto& bounds : m_bounds)
+    {
+        const auto [first, last] = bandRange(bounds);
+
+        for (auto band = first ; band <= last ; ++band)
+        {
+            ++m_bandStart[band + 1];
+        }
+    }
+
+    std::partial_sum(m_bandStart.begin(), m_bandStart.end(), m_bandStart.begin());
+    m_bandCommands.resize(m_bandStart.back());
+
+    std::vector<uint32_t> next(m_bandStart.begin(), m_bandStart.end() - 1);
+
+    for (uint32_t i = 0 ; i < m_bounds.size() ; ++i)
+    {
+        const auto [first, last] = bandRange(m_bounds[i]);
+
+        for (auto band = first ; band <= last ; ++band)
+        {
+            m_bandCommands[next[band]++] = i;
+        }
+    }
+
+    //---------------------------------------------------------------------
+    // Each band is drawn through its own view of the target, so threads
+    // do not share a clip stack.
+
+    // the buffer is fetched once, as asking an image for its buffer to
+    // write to may give it pixels of its own
+
+    const auto width = target.getDimensions().width();
+    const auto lineLength = target.getLineLengthPixels();
+    const auto buffer = target.getBuffer();
+    std::mutex fontMutex;
+
+    auto drawBand = [&](int band)
+    {
+        const auto first = m_bandStart[band];
+        const auto last = m_bandStart[band + 1];
+
+        if (first == last)
+        {
+            return;
+        }
+
+        const auto top = clip.top() + (band * m_bandHeight);
+        const auto rows = std::min(m_bandHeight, clip.bottom() + 1 - top);
+
+        Image565View view{buffer.subspan(target.offset(Point565{0, top})),
+                          Dimensions565{width, rows},
+                          lineLength};
+
+        view.pushClip(Rectangle565{Point565{clip.left(), 0},
+                                   Dimensions565{clip.width(), rows}});
+
+        auto move = [top](Point565 p)
+        {
+            p.translateY(-top);
+            return p;
+        };
+
+        for (auto i = first ; i < last ; ++i)
+        {
+            const auto& command = m_commands[m_bandCommands[i]];
+
+            if (const auto* b = std::get_if<Box>(&command))
+            {
+                if (b->m_filled)
+                {
+                    fb16::boxFilled(view, move(b->m_p1), move(b->m_p2), b->m_rgb);
+                }
+                else
+                {
+                    fb16::box(view, move(b->m_p1), move(b->m_p2), b->m_rgb);
+                }
+            }
+            else if (const auto* bb = std::get_if<BoxBlend>(&command))
+            {
+                fb16::boxFilled(view, move(bb->m_p1), move(bb->m_p2), bb->m_rgb, bb->m_alpha);
+            }
+            else if (const auto* l = std::get_if<Line>(&command))
+            {
+                fb16::line(view, move(l->m_p1), move(l->m_p2), l->m_rgb);
+            }
+            else if (const auto* im = std::get_if<Image>(&command))
+            {
+                view.putImage(move(im->m_p), *(im->m_image));
+            }
+            else if (const auto* t = std::get_if<Text>(&command))
+            {
+                std::scoped_lock lock{fontMutex};
+                t->m_font->drawString(move(t->m_p), t->m_text, t->m_rgb, view);
+            }
+        }
+    };
+
+    //---------------------------------------------------------------------
+
+    threads = std::min(threads, bands);
+
+    if (threads <= 1)
+    {
+        for (auto band = 0 ; band < bands ; ++band)
+        {
+            drawBand(band);
+        }
+
+        return;
+    }
+
+    std::atomic<int> nextBand{0};
+    std::exception_ptr error{};
+    std::mutex errorMutex;
+
+    auto worker = [&]
+    {
+        try
+        {
+            for (auto band = nextBand++ ; band < bands ; band = nextBand++)
+            {
+                drawBand(band);
+            }
+        }
+        catch (...)
+        {
+            std::scoped_lock lock{errorMutex};
+
+            if (not error)
+            {
+                error = std::current_exception();
+            }
+        }
+    };
+
+    {
+        std::vector<std::jthread> workers;
+
+        for (auto thread = 1 ; thread < threads ; ++thread)
+        {
+            workers.emplace_back(worker);
+        }
+
+        worker();
+    }
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+fb16::DrawList565::add(
+    const Rectangle565& bounds,
+    Command&& command)
+{
+    m_commands.push_back(std::move(command));
+    m_bounds.push_back(bounds);
+}
+
@@ -0,0 +1,166 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#include "interface565.h"
+#include "interface565Base.h"
+#include "interface565Font.h"
+#include "rgb565.h"
+
+//-------------------------------------------------------------------------
+
+namespace fb16
+{
+
+//-------------------------------------------------------------------------
+
+// A retained list of drawing commands. Nothing is drawn until execute(),
+// which sorts the commands into bands of rows and draws the target one
+// band at a time, in the order the commands were added. Each band is
+// small enough to stay in cache while every command that touches it is
+// drawn, and bands that no command touches are skipped.
+//
+// Fonts and images are held by reference, so they must outlive the list
+// (or at least the last call to execute()).
+
+class DrawList565
+{
+public:
+
+    static constexpr int c_defaultBandHeight{16};
+
+    explicit DrawList565(int bandHeight = c_defaultBandHeight);
+
+    void box(Point565 p1, Point565 p2, uint16_t rgb);
+    void box(Point565 p1, Point565 p2, const RGB565& rgb) { box(p1, p2, rgb.get565()); }
+
+    void boxFilled(Point565 p1, Point565 p2, uint16_t rgb);
+    void boxFilled(Point565 p1, Point565 p2, const RGB565& rgb) { boxFilled(p1, p2, rgb.get565()); }
+    void boxFilled(Point565 p1, Point565 p2, const RGB565& rgb, uint8_t alpha);
+
+    void line(Point565 p1, Point565 p2, uint16_t rgb);
+    void line(Point565 p1, Point565 p2, const RGB565& rgb) { line(p1, p2, rgb.get565()); }
+
+    void putImage(Point565 p, const Interface565Base& image);
+
+    void
+    text(
+        Point565 p,
+        std::string_view sv,
+        uint16_t rgb,
+        Interface565Font& font);
+
+    void
+    text(
+        Point565 p,
+        std::string_view sv,
+        const RGB565& rgb,
+        Interface565Font& font)
+    {
+        text(p, sv, rgb.get565(), font);
+    }
+
+    void clear() noexcept;
+
+    [[nodiscard]] bool empty() const noexcept { return m_commands.empty(); }
+    [[nodiscard]] std::size_t size() const noexcept { return m_commands.size(); }
+
+    // Draw the list into target, within its current clip. With more than
+    // one thread, bands are shared between the threads. Text is drawn by
+    // one thread at a time, as fonts are not thread safe.
+
+    void execute(Interface565Base& target, int threads = 1);
+
+private:
+
+    struct Box
+    {
+        Point565 m_p1;
+        Point565 m_p2;
+        uint16_t m_rgb;
+        bool m_filled;
+    };
+
+    struct BoxBlend
+    {
+        Point565 m_p1;
+        Point565 m_p2;
+        RGB565 m_rgb;
+        uint8_t m_alpha;
+    };
+
+    struct Line
+    {
+        Point565 m_p1;
+        Point565 m_p2;
+        uint16_t m_rgb;
+    };
+
+    struct Image
+    {
+        Point565 m_p;
+        const Interface565Base* m_image;
+    };
+
+    struct Text
+    {
+        Point565 m_p;
+        std::string m_text;
+        uint16_t m_rgb;
+        Interface565Font* m_font;
+    };
+
+    using Command = std::variant<Box, BoxBlend, Line, Image, Text>;
+
+    void add(const Rectangle565& bounds, Command&& command);
+
+    int m_bandHeight;
+    std::vector<Command> m_commands;
+    std::vector<Rectangle565> m_bounds;
+
+    // commands in each band, reused between calls to execute()
+
+    std::vector<uint32_t> m_bandStart;
+    std::vector<uint32_t> m_bandCommands;
+};
+
+//-------------------------------------------------------------------------
+
+} // namespace fb16
+
+//-------------------------------------------------------------------------
+
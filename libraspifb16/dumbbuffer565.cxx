@@ -38,16 +38,59 @@
 #include <sys/mman.h>
 
 #include <algorithm>
+#include <array>
 #include <fstream>
 #include <memory>
+#include <span>
 #include <string>
 #include <system_error>
 
 #include "drmMode.h"
 #include "dumbbuffer565.h"
 #include "image565.h"
+#include "image565Process.h"
+#include "image565View.h"
 #include "point.h"
 
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+// DRM plane rotation is counter-clockwise, Orientation565 is clockwise.
+
+uint64_t
+drmRotation(
+    fb16::Orientation565 orientation)
+{
+    switch (orientation)
+    {
+    case fb16::Orientation565::ROTATE_0:
+
+        return DRM_MODE_ROTATE_0;
+
+    case fb16::Orientation565::ROTATE_90:
+
+        return DRM_MODE_ROTATE_270;
+
+    case fb16::Orientation565::ROTATE_180:
+
+        return DRM_MODE_ROTATE_180;
+
+    case fb16::Orientation565::ROTATE_270:
+
+        return DRM_MODE_ROTATE_90;
+    }
+
+    return DRM_MODE_ROTATE_0;
+}
+
+//-------------------------------------------------------------------------
+
+} // namespace
+
 //=========================================================================
 
 fb16::DumbBuffer565::DumbBuffer565(
@@ -67,7 +110,10 @@ fb16::DumbBuffer565::DumbBuffer565(
     m_crtcId{0},
     m_planeId{0},
     m_mode{},
-    m_originalCrtc(nullptr, [](drmModeCrtc*){})
+    m_originalCrtc(nullptr, [](drmModeCrtc*){}),
+    m_orientation{Orientation565::ROTATE_0},
+    m_planeRotation{false},
+    m_shadow{}
 {
     std::string card{device};
 
@@ -112,8 +158,8 @@ fb16::DumbBuffer565::DumbBuffer565(
 
     //---------------------------------------------------------------------
 
-    createDumbBuffer(m_dbFront);
-    createDumbBuffer(m_dbBack);
+    createDumbBuffer(m_dbs[m_dbFront], m_dimensions);
+    createDumbBuffer(m_dbs[m_dbBack], m_dimensions);
 
     setDumbBuffer(m_dbFront);
 
@@ -126,8 +172,29 @@ fb16::DumbBuffer565::DumbBuffer565(
 
 fb16::DumbBuffer565::~DumbBuffer565()
 {
+    if (m_planeRotation)
+    {
+        try
+        {
+            setPlaneRotation(Orientation565::ROTATE_0);
+        }
+        catch (...)
+        {
+            // do nothing
+        }
+    }
+
     clear();
-    updateImpl();
+
+    try
+    {
+        updateImpl();
+    }
+    catch (...)
+    {
+        // do nothing
+    }
+
     clear();
 
     if (useAtomic())
@@ -135,8 +202,8 @@ fb16::DumbBuffer565::~DumbBuffer565()
         drm::drmModeDestroyPropertyBlob(m_fd, m_blobId);
     }
 
-    destroyDumbBuffer(m_dbBack);
-    destroyDumbBuffer(m_dbFront);
+    destroyDumbBuffer(m_dbs[m_dbBack]);
+    destroyDumbBuffer(m_dbs[m_dbFront]);
 
     drm::drmModeSetCrtc(m_fd,
                         m_originalCrtc->crtc_id,
@@ -167,8 +234,13 @@ fb16::DumbBuffer565::clearBuffers(
 //-------------------------------------------------------------------------
 
 std::span<uint16_t>
-fb16::DumbBuffer565::getBuffer() & noexcept
+fb16::DumbBuffer565::getBuffer() &
 {
+    if (useShadow())
+    {
+        return m_shadow.getBuffer();
+    }
+
     const auto& dbb = m_dbs[m_dbBack];
     return {dbb.m_fbp, getBufferSize()};
 }
@@ -178,6 +250,11 @@ fb16::DumbBuffer565::getBuffer() & noexcept
 std::span<const uint16_t>
 fb16::DumbBuffer565::getBuffer() const & noexcept
 {
+    if (useShadow())
+    {
+        return m_shadow.getBuffer();
+    }
+
     const auto& dbb = m_dbs[m_dbBack];
     return {dbb.m_fbp, getBufferSize()};
 }
@@ -195,6 +272,11 @@ fb16::DumbBuffer565::getBufferSize() const noexcept
 int
 fb16::DumbBuffer565::getLineLengthPixels() const noexcept
 {
+    if (useShadow())
+    {
+        return m_shadow.getLineLengthPixels();
+    }
+
     const auto& dbb = m_dbs[m_dbBack];
     return dbb.m_lineLengthPixels;
 }
@@ -205,6 +287,11 @@ std::size_t
 fb16::DumbBuffer565::offset(
     const Point565 p) const noexcept
 {
+    if (useShadow())
+    {
+        return m_shadow.offset(p);
+    }
+
     const auto& dbb = m_dbs[m_dbBack];
     return p.x() + p.y() * dbb.m_lineLengthPixels;
 }
@@ -236,11 +323,134 @@ fb16::DumbBuffer565::disown() noexcept
 //-------------------------------------------------------------------------
 
 bool
-fb16::DumbBuffer565::updateImpl() noexcept
+fb16::DumbBuffer565::setOrientation(
+    Orientation565 orientation)
 {
+    if (orientation == m_orientation)
+    {
+        return true;
+    }
+
+    damageAll();
+
+    if (setPlaneRotation(orientation))
+    {
+        m_shadow = Image565{};
+        clipToSurface();
+        return true;
+    }
+
+    //---------------------------------------------------------------------
+    // The plane cannot be rotated, so draw into a shadow image and rotate
+    // it into the back buffer on each update.
+
+    if (m_planeRotation and not setPlaneRotation(Orientation565::ROTATE_0))
+    {
+        return false;
+    }
+
+    const auto pd = getPhysicalDimensions();
+
+    m_orientation = orientation;
+
+    switch (orientation)
+    {
+    case Orientation565::ROTATE_0:
+
+        m_dimensions = pd;
+        m_shadow = Image565{};
+        break;
+
+    case Orientation565::ROTATE_90:
+    case Orientation565::ROTATE_270:
+
+        m_dimensions = Dimensions565{pd.height(), pd.width()};
+        m_shadow = Image565{m_dimensions};
+        break;
+
+    case Orientation565::ROTATE_180:
+
+        m_dimensions = pd;
+        m_shadow = Image565{m_dimensions};
+        break;
+    }
+
+    clipToSurface();
+
+    return true;
+}
+
+//-------------------------------------------------------------------------
+
+bool
+fb16::DumbBuffer565::updateImpl()
+{
+    auto view = [](DumbBuffer& db)
+    {
+        const auto& d = db.m_dimensions;
+        const auto length = static_cast<std::size_t>(db.m_lineLengthPixels) *
+                            d.height();
+
+        return Image565View{{db.m_fbp, length}, d, db.m_lineLengthPixels};
+    };
+
+    const auto damage = getDamage();
+    const bool reported = damageReported();
+
+    if (useShadow())
+    {
+        auto back = view(m_dbs[m_dbBack]);
+
+        if (damage.empty())
+        {
+            orientTo(m_shadow, back, m_orientation);
+        }
+        else
+        {
+            for (const auto& area : damage)
+            {
+                orientTo(m_shadow, back, m_orientation, area);
+            }
+        }
+    }
+
     std::swap(m_dbFront, m_dbBack);
     const auto& dbf = m_dbs[m_dbFront];
 
+    // The next frame is drawn over the buffer shown two frames ago. When
+    // damage is being reported, only the damage will be redrawn, so bring
+    // that buffer up to date with the one just shown (all of it, if this
+    // update was of the whole surface). The two then only ever differ by
+    // the damage.
+
+    if (reported)
+    {
+        auto back = view(m_dbs[m_dbBack]);
+
+        const std::array<Rectangle565, 1> all{Rectangle565{Point565{0, 0}, getDimensions()}};
+        const auto areas = (damage.empty()) ? std::span<const Rectangle565>{all} : damage;
+
+        for (const auto& area : areas)
+        {
+            if (useShadow())
+            {
+                orientTo(m_shadow, back, m_orientation, area);
+            }
+            else
+            {
+                const auto front = view(m_dbs[m_dbFront]);
+
+                for (auto j = area.top() ; j <= area.bottom() ; ++j)
+                {
+                    std::ranges::copy(front.getRow(j).subspan(area.left(), area.width()),
+                                      back.getRow(j).begin() + area.left());
+                }
+            }
+        }
+    }
+
+    clearDamage();
+
     if (useAtomic())
     {
         auto atomicReq = drm::drmModeAtomicAlloc();
@@ -280,13 +490,12 @@ fb16::DumbBuffer565::updateImpl() noexcept
 
 void
 fb16::DumbBuffer565::createDumbBuffer(
-    int index)
+    DumbBuffer& db,
+    Dimensions565 d)
 {
-    auto& db = m_dbs[index];
-
     drm_mode_create_dumb dmcb;
-    dmcb.height = m_mode.vdisplay;
-    dmcb.width = m_mode.hdisplay;
+    dmcb.height = d.height();
+    dmcb.width = d.width();
     dmcb.bpp = 16;
     dmcb.flags = 0;
     dmcb.handle = 0;
@@ -305,14 +514,15 @@ fb16::DumbBuffer565::createDumbBuffer(
     db.m_length = dmcb.size;
     db.m_lineLengthPixels = dmcb.pitch / c_bytesPerPixel;
     db.m_fbHandle = dmcb.handle;
+    db.m_dimensions = d;
 
     uint32_t handles[4] = { dmcb.handle };
     uint32_t strides[4] = { dmcb.pitch };
     uint32_t offsets[4] = { 0 };
 
     const auto added = drmModeAddFB2(m_fd.fd(),
-                                     m_mode.hdisplay,
-                                     m_mode.vdisplay,
+                                     d.width(),
+                                     d.height(),
                                      DRM_FORMAT_RGB565,
                                      handles,
                                      strides,
@@ -359,17 +569,107 @@ fb16::DumbBuffer565::createDumbBuffer(
 
 void
 fb16::DumbBuffer565::destroyDumbBuffer(
-    int index)
+    DumbBuffer& db)
 {
-    const auto& db = m_dbs[index];
+    if (db.m_fbp)
+    {
+        ::munmap(db.m_fbp, db.m_length);
+    }
+
+    if (db.m_fbId)
+    {
+        drm::drmModeRmFB(m_fd, db.m_fbId);
+    }
 
-    ::munmap(db.m_fbp, db.m_length);
-    drm::drmModeRmFB(m_fd, db.m_fbId);
+    if (db.m_fbHandle)
+    {
+        drm_mode_destroy_dumb dmdd;
+        dmdd.handle = db.m_fbHandle;
 
-    drm_mode_destroy_dumb dmdd;
-    dmdd.handle = db.m_fbHandle;
+        drm::drmIoctl(m_fd, DRM_IOCTL_MODE_DESTROY_DUMB, &dmdd);
+    }
 
-    drm::drmIoctl(m_fd, DRM_IOCTL_MODE_DESTROY_DUMB, &dmdd);
+    db = DumbBuffer{};
+}
+
+//-------------------------------------------------------------------------
+
+// Rotate the primary plane in hardware. The dumb buffers are recreated
+// with the logical (rotated) dimensions, and the new configuration is
+// checked with a test only commit before anything is changed.
+
+bool
+fb16::DumbBuffer565::setPlaneRotation(
+    Orientation565 orientation)
+{
+    if (not useAtomic())
+    {
+        return false;
+    }
+
+    if (drm::findDrmPropertyId(m_fd,
+                               m_planeId,
+                               DRM_MODE_OBJECT_PLANE,
+                               "rotation") == 0)
+    {
+        return false;
+    }
+
+    //---------------------------------------------------------------------
+
+    const auto pd = getPhysicalDimensions();
+    const bool transpose = (orientation == Orientation565::ROTATE_90) or
+                           (orientation == Orientation565::ROTATE_270);
+    const auto d = (transpose) ? Dimensions565{pd.height(), pd.width()} : pd;
+
+    std::array<DumbBuffer, 2> dbs{};
+
+    try
+    {
+        createDumbBuffer(dbs[0], d);
+        createDumbBuffer(dbs[1], d);
+    }
+    catch (const std::system_error&)
+    {
+        destroyDumbBuffer(dbs[1]);
+        destroyDumbBuffer(dbs[0]);
+        return false;
+    }
+
+    const auto previousProperties = m_atomicProperties;
+
+    setAtomicRequest(m_planeId, DRM_MODE_OBJECT_PLANE, "SRC_W", static_cast<uint64_t>(d.width()) << 16);
+    setAtomicRequest(m_planeId, DRM_MODE_OBJECT_PLANE, "SRC_H", static_cast<uint64_t>(d.height()) << 16);
+    setAtomicRequest(m_planeId, DRM_MODE_OBJECT_PLANE, "rotation", drmRotation(orientation));
+
+    auto atomicReq = drm::drmModeAtomicAlloc();
+    addAtomicProperties(atomicReq, dbs[0].m_fbId);
+    constexpr uint32_t flags = DRM_MODE_ATOMIC_TEST_ONLY | DRM_MODE_ATOMIC_ALLOW_MODESET;
+
+    if (drm::drmModeAtomicCommit(m_fd, atomicReq, flags, nullptr) < 0)
+    {
+        m_atomicProperties = previousProperties;
+        destroyDumbBuffer(dbs[1]);
+        destroyDumbBuffer(dbs[0]);
+        return false;
+    }
+
+    //---------------------------------------------------------------------
+
+    std::swap(m_dbs, dbs);
+    m_dbFront = 0;
+    m_dbBack = 1;
+
+    setDumbBuffer(m_dbFront);
+
+    destroyDumbBuffer(dbs[1]);
+    destroyDumbBuffer(dbs[0]);
+
+    m_dimensions = d;
+    m_orientation = orientation;
+    m_planeRotation = (orientation != Orientation565::ROTATE_0);
+
+    return true;
 }
 
 //-------------------------------------------------------------------------
@@ -498,6 +798,28 @@ fb16::DumbBuffer565::createAtomicRequests()
 
 //-------------------------------------------------------------------------
 
+void
+fb16::DumbBuffer565::setAtomicRequest(
+    uint32_t objectId,
+    uint32_t objectType,
+    const std::string& propertyName,
+    uint64_t value)
+{
+    for (auto& prop : m_atomicProperties)
+    {
+        if ((prop.m_objectId == objectId) and
+            (prop.m_propertyName == propertyName))
+        {
+            prop.m_value = value;
+            return;
+        }
+    }
+
+    addAtomicRequest(objectId, objectType, propertyName, value);
+}
+
+//-------------------------------------------------------------------------
+
 void
 fb16::DumbBuffer565::findResources(
     uint32_t connectorId)
@@ -36,6 +36,7 @@
 #include "drmMode.h"
 #include "point.h"
 #include "fileDescriptor.h"
+#include "image565.h"
 #include "interface565Base.h"
 #include "rgb565.h"
 
@@ -50,10 +51,6 @@ using Point565 = Point<int32_t>;
 
 //-------------------------------------------------------------------------
 
-class Image565;
-
-//-------------------------------------------------------------------------
-
 class DumbBuffer565 final
 :
     public Interface565Base
@@ -65,6 +62,7 @@ public:
     struct DumbBuffer
     {
         uint16_t* m_fbp{nullptr};
+        Dimensions565 m_dimensions{};
         uint32_t m_fbId{0};
         uint32_t m_fbHandle{0};
         int m_length{0};
@@ -100,16 +98,19 @@ public:
 
     [[nodiscard]] Dimensions565 getDimensions() const noexcept final { return m_dimensions; }
 
-    [[nodiscard]] std::span<uint16_t> getBuffer() & noexcept final;
+    [[nodiscard]] std::span<uint16_t> getBuffer() & final;
     [[nodiscard]] std::span<const uint16_t> getBuffer() const & noexcept final;
 
     [[nodiscard]] std::span<uint16_t> getBuffer() && noexcept = delete;
     [[nodiscard]] std::span<const uint16_t> getBuffer() const && noexcept = delete;
 
     [[nodiscard]] std::size_t getBufferSize() const noexcept;
+    [[nodiscard]] bool deviceMemory() const noexcept final { return not useShadow(); }
     [[nodiscard]] drm::drmVersion_ptr getDrmVersion() noexcept { return drm::drmGetVersion(m_fd); }
     [[nodiscard]] int getLineLengthPixels() const noexcept final;
+    [[nodiscard]] Orientation565 getOrientation() const noexcept final { return m_orientation; }
     [[nodiscard]] bool hasAtomic() const noexcept { return m_hasAtomic; }
+    [[nodiscard]] bool hasPlaneRotation() const noexcept { return m_planeRotation; }
     [[nodiscard]] bool hasUniversalPlanes() const noexcept { return m_hasUniversalPlanes; }
     [[nodiscard]] std::size_t offset(const Point565 p) const noexcept final;
 
@@ -118,15 +119,30 @@ public:
     void own() noexcept final;
     void disown() noexcept final;
 
-    bool update() noexcept final { return updateImpl(); }
+    bool setOrientation(Orientation565 orientation) final;
+
+    // Damage reported with addDamage() is only redrawn into the back
+    // buffer, so the two buffers must already match outside of it. After
+    // any update with damage reported, including a whole surface update,
+    // the next back buffer is brought up to date with the one shown.
+
+    bool update() final { return updateImpl(); }
 
 private:
 
-    void createDumbBuffer(int index);
-    void destroyDumbBuffer(int index);
+    void createDumbBuffer(DumbBuffer& db, Dimensions565 d);
+    void destroyDumbBuffer(DumbBuffer& db);
     void setDumbBuffer(int index);
 
-    bool updateImpl() noexcept;
+    [[nodiscard]] Dimensions565
+    getPhysicalDimensions() const noexcept
+    {
+        return {m_mode.hdisplay, m_mode.vdisplay};
+    }
+
+    bool setPlaneRotation(Orientation565 orientation);
+
+    bool updateImpl();
 
     void
     addAtomicProperties(
@@ -139,10 +155,21 @@ private:
         const std::string& propertyName,
         uint64_t value);
     void createAtomicRequests();
+    void
+    setAtomicRequest(
+        uint32_t objectId,
+        uint32_t objectType,
+        const std::string& propertyName,
+        uint64_t value);
 
     void findResources(uint32_t connectorId);
 
     [[nodiscard]] bool useAtomic() const noexcept { return m_hasAtomic and m_hasUniversalPlanes; }
+    [[nodiscard]] bool
+    useShadow() const noexcept
+    {
+        return (m_orientation != Orientation565::ROTATE_0) and not m_planeRotation;
+    }
 
     Dimensions565 m_dimensions;
 
@@ -161,6 +188,10 @@ private:
     uint32_t m_planeId;
     drmModeModeInfo m_mode;
     drm::drmModeCrtc_ptr m_originalCrtc;
+
+    Orientation565 m_orientation;
+    bool m_planeRotation;
+    Image565 m_shadow;
 };
 
 //-------------------------------------------------------------------------
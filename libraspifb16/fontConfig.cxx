@@ -26,8 +26,10 @@
 //-------------------------------------------------------------------------
 
 #include "fontConfig.h"
+#include "fontManager.h"
 #include "image565Font8x16.h"
 #include "image565FreeType.h"
+#include "tokenize.h"
 
 //-------------------------------------------------------------------------
 
@@ -44,7 +46,7 @@ createFont(
     {
         try
         {
-            return std::make_unique<fb16::Image565FreeType>(fontConfig);
+            return FontManager::getDefault().createFont(fontConfig);
         }
         catch (const std::exception& error)
         {
@@ -67,14 +69,17 @@ parseFontConfig(
 
     size_t separatorPos = fontConfigStr.find(':');
 
-    if (separatorPos == std::string_view::npos)
+    const auto fontFiles = tokenize(fontConfigStr.substr(0, separatorPos),
+                                    [](char c) { return c == ','; });
+
+    if (not fontFiles.empty())
     {
-        config.m_fontFile = std::string(fontConfigStr);
+        config.m_fontFile = std::string(fontFiles.front());
+        config.m_fallbackFontFiles.assign(std::next(fontFiles.begin()), fontFiles.end());
     }
-    else
-    {
-        config.m_fontFile = std::string(fontConfigStr.substr(0, separatorPos));
 
+    if (separatorPos != std::string_view::npos)
+    {
         std::string_view pixelHeightStr = fontConfigStr.substr(separatorPos + 1);
 
         try
@@ -32,6 +32,7 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "interface565Font.h"
 
@@ -46,6 +47,8 @@ struct FontConfig
 {
     std::string m_fontFile;
     int m_pixelHeight{};
+    std::vector<std::string> m_fallbackFontFiles{};
+    bool m_lcdRendering{};
 };
 
 //-------------------------------------------------------------------------
@@ -54,6 +57,8 @@ std::unique_ptr<fb16::Interface565Font>
 createFont(
     const FontConfig& fontConfig);
 
+// Parse "file[,fallback file...][:pixel height]".
+
 FontConfig
 parseFontConfig(
     const std::string_view fontConfigStr,
@@ -0,0 +1,188 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <ft2build.h>
+#include <freetype/ftlcdfil.h>
+
+#include <stdexcept>
+#include <system_error>
+
+#include "fileDescriptor.h"
+#include "fontManager.h"
+#include "image565FreeType.h"
+
+//=========================================================================
+
+fb16::FreeTypeLibrary::FreeTypeLibrary()
+{
+    if (FT_Init_FreeType(&m_library) != 0)
+    {
+        throw std::invalid_argument("FreeType initialization failed");
+    }
+
+    // For LCD rendering. FreeType built for ClearType style rendering
+    // needs the filter; the default (Harmony) rendering has none to set.
+
+    FT_Library_SetLcdFilter(m_library, FT_LCD_FILTER_DEFAULT);
+}
+
+//-------------------------------------------------------------------------
+
+fb16::FreeTypeLibrary::~FreeTypeLibrary()
+{
+    FT_Done_FreeType(m_library);
+}
+
+//=========================================================================
+
+fb16::FreeTypeFace::FreeTypeFace(
+    std::shared_ptr<FreeTypeLibrary> library,
+    const std::string& fontFile)
+:
+    m_library{std::move(library)}
+{
+    fd::FileDescriptor fd{::open(fontFile.c_str(), O_RDONLY)};
+
+    if (fd.fd() == -1)
+    {
+        throw std::invalid_argument("FreeType could not open " + fontFile);
+    }
+
+    struct stat status{};
+
+    if ((::fstat(fd.fd(), &status) == -1) or (status.st_size == 0))
+    {
+        throw std::invalid_argument("FreeType could not open " + fontFile);
+    }
+
+    m_length = static_cast<std::size_t>(status.st_size);
+    m_data = ::mmap(nullptr, m_length, PROT_READ, MAP_PRIVATE, fd.fd(), 0);
+
+    if (m_data == MAP_FAILED)
+    {
+        throw std::system_error(errno,
+                                std::system_category(),
+                                "mapping font file " + fontFile);
+    }
+
+    if (FT_New_Memory_Face(m_library->get(),
+                           static_cast<const FT_Byte*>(m_data),
+                           static_cast<FT_Long>(m_length),
+                           0,
+                           &m_face) != 0)
+    {
+        ::munmap(m_data, m_length);
+        throw std::invalid_argument("FreeType could not open " + fontFile);
+    }
+}
+
+//-------------------------------------------------------------------------
+
+fb16::FreeTypeFace::~FreeTypeFace()
+{
+    FT_Done_Face(m_face);
+    ::munmap(m_data, m_length);
+}
+
+//=========================================================================
+
+fb16::FontManager::FontManager()
+:
+    m_library{std::make_shared<FreeTypeLibrary>()},
+    m_faces{}
+{
+}
+
+//-------------------------------------------------------------------------
+
+std::shared_ptr<fb16::FreeTypeFace>
+fb16::FontManager::getFace(
+    const std::string& fontFile)
+{
+    auto& entry = m_faces[fontFile];
+    auto face = entry.lock();
+
+    if (not face)
+    {
+        try
+        {
+            face = std::make_shared<FreeTypeFace>(m_library, fontFile);
+        }
+        catch (...)
+        {
+            m_faces.erase(fontFile);
+            throw;
+        }
+
+        entry = face;
+    }
+
+    return face;
+}
+
+//-------------------------------------------------------------------------
+
+std::unique_ptr<fb16::Image565FreeType>
+fb16::FontManager::createFont(
+    const std::string& fontFile,
+    int pixelSize)
+{
+    return std::make_unique<Image565FreeType>(getFace(fontFile), pixelSize);
+}
+
+//-------------------------------------------------------------------------
+
+std::unique_ptr<fb16::Image565FreeType>
+fb16::FontManager::createFont(
+    const FontConfig& fontConfig)
+{
+    auto font = createFont(fontConfig.m_fontFile, fontConfig.m_pixelHeight);
+    font->setLcdRendering(fontConfig.m_lcdRendering);
+
+    for (const auto& fontFile : fontConfig.m_fallbackFontFiles)
+    {
+        font->addFallbackFont(getFace(fontFile));
+    }
+
+    return font;
+}
+
+//-------------------------------------------------------------------------
+
+fb16::FontManager&
+fb16::FontManager::getDefault()
+{
+    static FontManager manager;
+
+    return manager;
+}
+
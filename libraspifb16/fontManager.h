@@ -0,0 +1,144 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <ft2build.h>
+#include <freetype/freetype.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "fontConfig.h"
+
+//-------------------------------------------------------------------------
+
+namespace fb16
+{
+
+//-------------------------------------------------------------------------
+
+class Image565FreeType;
+
+//-------------------------------------------------------------------------
+
+// The FreeType library, kept alive by every face opened with it.
+
+class FreeTypeLibrary
+{
+public:
+
+    FreeTypeLibrary();
+    ~FreeTypeLibrary();
+
+    FreeTypeLibrary(const FreeTypeLibrary&) = delete;
+    FreeTypeLibrary(FreeTypeLibrary&&) = delete;
+    FreeTypeLibrary& operator=(const FreeTypeLibrary&) = delete;
+    FreeTypeLibrary& operator=(FreeTypeLibrary&&) = delete;
+
+    [[nodiscard]] FT_Library get() const noexcept { return m_library; }
+
+private:
+
+    FT_Library m_library{};
+};
+
+//-------------------------------------------------------------------------
+
+// A font file, memory mapped and opened once, shared by every
+// Image565FreeType drawing with it. Each font has its own FT_Size, so
+// different sizes of the same face do not disturb each other.
+
+class FreeTypeFace
+{
+public:
+
+    FreeTypeFace(std::shared_ptr<FreeTypeLibrary> library, const std::string& fontFile);
+    ~FreeTypeFace();
+
+    FreeTypeFace(const FreeTypeFace&) = delete;
+    FreeTypeFace(FreeTypeFace&&) = delete;
+    FreeTypeFace& operator=(const FreeTypeFace&) = delete;
+    FreeTypeFace& operator=(FreeTypeFace&&) = delete;
+
+    [[nodiscard]] FT_Face get() const noexcept { return m_face; }
+
+private:
+
+    std::shared_ptr<FreeTypeLibrary> m_library;
+    void* m_data{nullptr};
+    std::size_t m_length{};
+    FT_Face m_face{};
+};
+
+//-------------------------------------------------------------------------
+
+// Opens each font file once, and hands out fonts of any size that share
+// it. A face is closed when the last font using it is destroyed.
+//
+// FreeType is not thread safe, so the fonts from a manager should all be
+// used from one thread.
+
+class FontManager
+{
+public:
+
+    FontManager();
+
+    [[nodiscard]] std::shared_ptr<FreeTypeFace> getFace(const std::string& fontFile);
+
+    [[nodiscard]] std::unique_ptr<Image565FreeType>
+    createFont(
+        const std::string& fontFile,
+        int pixelSize);
+
+    [[nodiscard]] std::unique_ptr<Image565FreeType>
+    createFont(
+        const FontConfig& fontConfig);
+
+    // The manager used by Image565FreeType's file constructors and by
+    // fb16::createFont().
+
+    [[nodiscard]] static FontManager& getDefault();
+
+private:
+
+    std::shared_ptr<FreeTypeLibrary> m_library;
+    std::unordered_map<std::string, std::weak_ptr<FreeTypeFace>> m_faces;
+};
+
+//-------------------------------------------------------------------------
+
+} // namespace fb16
+
+//-------------------------------------------------------------------------
+
@@ -40,6 +40,8 @@
 
 #include "framebuffer565.h"
 #include "image565.h"
+#include "image565Process.h"
+#include "image565View.h"
 #include "point.h"
 
 //-------------------------------------------------------------------------
@@ -51,7 +53,9 @@ fb16::FrameBuffer565::FrameBuffer565(
     m_finfo{},
     m_vinfo{},
     m_lineLengthPixels{0},
-    m_fbp{nullptr}
+    m_fbp{nullptr},
+    m_orientation{Orientation565::ROTATE_0},
+    m_shadow{}
 {
     fd::FileDescriptor fbfd{::open(device.c_str(), O_RDWR)};
 
@@ -116,6 +120,16 @@ fb16::FrameBuffer565::FrameBuffer565(
 fb16::FrameBuffer565::~FrameBuffer565()
 {
     clear();
+
+    try
+    {
+        update();
+    }
+    catch (...)
+    {
+        // do nothing
+    }
+
     std::this_thread::sleep_for(std::chrono::milliseconds(100));
     ::munmap(m_fbp, m_finfo.smem_len);
 
@@ -130,7 +144,51 @@ fb16::FrameBuffer565::~FrameBuffer565()
 fb16::Dimensions565
 fb16::FrameBuffer565::getDimensions() const noexcept
 {
-    return {static_cast<int>(m_vinfo.xres), static_cast<int>(m_vinfo.yres)};
+    if (useShadow())
+    {
+        return m_shadow.getDimensions();
+    }
+
+    return getPhysicalDimensions();
+}
+
+//-------------------------------------------------------------------------
+
+std::span<uint16_t>
+fb16::FrameBuffer565::getBuffer() &
+{
+    if (useShadow())
+    {
+        return m_shadow.getBuffer();
+    }
+
+    return {m_fbp, getPhysicalBufferSize()};
+}
+
+//-------------------------------------------------------------------------
+
+std::span<const uint16_t>
+fb16::FrameBuffer565::getBuffer() const & noexcept
+{
+    if (useShadow())
+    {
+        return m_shadow.getBuffer();
+    }
+
+    return {m_fbp, getPhysicalBufferSize()};
+}
+
+//-------------------------------------------------------------------------
+
+int
+fb16::FrameBuffer565::getLineLengthPixels() const noexcept
+{
+    if (useShadow())
+    {
+        return m_shadow.getLineLengthPixels();
+    }
+
+    return m_lineLengthPixels;
 }
 
 //-------------------------------------------------------------------------
@@ -174,6 +232,96 @@ std::size_t
 fb16::FrameBuffer565::offset(
     const Point565 p) const noexcept
 {
+    if (useShadow())
+    {
+        return m_shadow.offset(p);
+    }
+
     return p.x() + p.y() * m_lineLengthPixels;
 }
 
+//-------------------------------------------------------------------------
+
+// The frame buffer has no plane to rotate, so draw into a shadow image
+// and rotate it into the frame buffer on each update.
+
+bool
+fb16::FrameBuffer565::setOrientation(
+    Orientation565 orientation)
+{
+    const auto pd = getPhysicalDimensions();
+
+    m_orientation = orientation;
+    damageAll();
+
+    switch (orientation)
+    {
+    case Orientation565::ROTATE_0:
+
+        m_shadow = Image565{};
+        break;
+
+    case Orientation565::ROTATE_90:
+    case Orientation565::ROTATE_270:
+
+        m_shadow = Image565{Dimensions565{pd.height(), pd.width()}};
+        break;
+
+    case Orientation565::ROTATE_180:
+
+        m_shadow = Image565{pd};
+        break;
+    }
+
+    clipToSurface();
+
+    return true;
+}
+
+//-------------------------------------------------------------------------
+
+bool
+fb16::FrameBuffer565::update()
+{
+    if (useShadow())
+    {
+        Image565View fb{{m_fbp, getPhysicalBufferSize()},
+                        getPhysicalDimensions(),
+                        m_lineLengthPixels};
+
+        const auto damage = getDamage();
+
+        if (damage.empty())
+        {
+            orientTo(m_shadow, fb, m_orientation);
+        }
+        else
+        {
+            for (const auto& area : damage)
+            {
+                orientTo(m_shadow, fb, m_orientation, area);
+            }
+        }
+    }
+
+    clearDamage();
+
+    return false;
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Dimensions565
+fb16::FrameBuffer565::getPhysicalDimensions() const noexcept
+{
+    return {static_cast<int>(m_vinfo.xres), static_cast<int>(m_vinfo.yres)};
+}
+
+//-------------------------------------------------------------------------
+
+std::size_t
+fb16::FrameBuffer565::getPhysicalBufferSize() const noexcept
+{
+    return static_cast<std::size_t>(m_lineLengthPixels) * m_vinfo.yres;
+}
+
@@ -37,6 +37,7 @@
 #include <linux/fb.h>
 
 #include "fileDescriptor.h"
+#include "image565.h"
 #include "interface565Base.h"
 #include "point.h"
 #include "rgb565.h"
@@ -48,10 +49,6 @@ namespace fb16
 
 //-------------------------------------------------------------------------
 
-class Image565;
-
-//-------------------------------------------------------------------------
-
 class FrameBuffer565 final
 :
     public Interface565Base
@@ -72,21 +69,30 @@ public:
 
     bool hideCursor() noexcept;
 
-    [[nodiscard]] std::span<uint16_t> getBuffer() & noexcept final { return {m_fbp, getBufferSize()}; };
-    [[nodiscard]] std::span<const uint16_t> getBuffer() const & noexcept final { return {m_fbp, getBufferSize()}; }
+    [[nodiscard]] std::span<uint16_t> getBuffer() & final;
+    [[nodiscard]] std::span<const uint16_t> getBuffer() const & noexcept final;
 
     [[nodiscard]] std::span<uint16_t> getBuffer() && noexcept = delete;
     [[nodiscard]] std::span<const uint16_t> getBuffer() const && noexcept = delete;
 
-    [[nodiscard]] std::size_t getBufferSize() const noexcept
-    {
-        return  static_cast<std::size_t>(m_lineLengthPixels) * getDimensions().height();
-    }
-    [[nodiscard]] int getLineLengthPixels() const noexcept final { return m_lineLengthPixels; }
+    [[nodiscard]] std::size_t getBufferSize() const noexcept { return getBuffer().size(); }
+    [[nodiscard]] int getLineLengthPixels() const noexcept final;
     [[nodiscard]] std::size_t offset(const Point565 p) const noexcept final;
 
+    [[nodiscard]] bool deviceMemory() const noexcept final { return not useShadow(); }
+
+    [[nodiscard]] Orientation565 getOrientation() const noexcept final { return m_orientation; }
+    bool setOrientation(Orientation565 orientation) final;
+
+    bool update() final;
+
 private:
 
+    [[nodiscard]] Dimensions565 getPhysicalDimensions() const noexcept;
+    [[nodiscard]] std::size_t getPhysicalBufferSize() const noexcept;
+
+    [[nodiscard]] bool useShadow() const noexcept { return m_orientation != Orientation565::ROTATE_0; }
+
     fd::FileDescriptor m_consolefd;
 
     struct fb_fix_screeninfo m_finfo;
@@ -95,6 +101,9 @@ private:
     int32_t m_lineLengthPixels;
 
     uint16_t* m_fbp;
+
+    Orientation565 m_orientation;
+    Image565 m_shadow;
 };
 
 //-------------------------------------------------------------------------
@@ -40,7 +40,7 @@ fb16::Image565::Image565(
     fb16::Dimensions565 d)
 :
     m_dimensions{d},
-    m_buffer(d.area())
+    m_pixels{std::make_shared<Pixels>(d.area())}
 {
 }
 
@@ -51,13 +51,13 @@ fb16::Image565::Image565(
     std::initializer_list<uint16_t> buffer)
 :
     m_dimensions{d},
-    m_buffer{buffer}
+    m_pixels{std::make_shared<Pixels>(buffer)}
 {
     const std::size_t minBufferSize = d.area();
 
-    if (m_buffer.size() < minBufferSize)
+    if (m_pixels->size() < minBufferSize)
     {
-        m_buffer.reserve(minBufferSize);
+        m_pixels->reserve(minBufferSize);
     }
 }
 
@@ -67,25 +67,50 @@ fb16::Image565::Image565(
     std::span<const uint16_t> buffer)
 :
     m_dimensions{d},
-    m_buffer{}
+    m_pixels{std::make_shared<Pixels>(cbegin(buffer), cend(buffer))}
 {
-    m_buffer.assign(cbegin(buffer), cend(buffer));
-
     const std::size_t minBufferSize = d.area();
 
-    if (m_buffer.size() < minBufferSize)
+    if (m_pixels->size() < minBufferSize)
     {
-        m_buffer.reserve(minBufferSize);
+        m_pixels->reserve(minBufferSize);
     }
 }
 
 //-------------------------------------------------------------------------
 
+fb16::Image565::Image565(
+    const Image565& image)
+:
+    Interface565Base(image),
+    m_dimensions{},
+    m_pixels{}
+{
+    share(image);
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Image565&
+fb16::Image565::operator=(
+    const Image565& image)
+{
+    if (&image != this)
+    {
+        Interface565Base::operator=(image);
+        share(image);
+    }
+
+    return *this;
+}
+
+//-------------------------------------------------------------------------
+
 fb16::Image565::Image565(
     const Interface565Base& i)
 :
-    m_dimensions{i.getDimensions()},
-    m_buffer(i.getDimensions().area())
+    m_dimensions{},
+    m_pixels{}
 {
     copy(i);
 }
@@ -106,23 +131,97 @@ fb16::Image565::operator=(
 
 //-------------------------------------------------------------------------
 
+void
+fb16::Image565::setDimensions(
+    Dimensions565 d)
+{
+    // resize() only reallocates when the buffer grows, so an image that
+    // is repeatedly used as an output keeps its storage.
+
+    m_dimensions = d;
+    clipToSurface();
+
+    if (m_pixels.use_count() == 1)
+    {
+        m_pixels->resize(d.area());
+        return;
+    }
+
+    auto pixels = std::make_shared<Pixels>(d.area());
+
+    if (m_pixels)
+    {
+        std::copy_n(m_pixels->begin(),
+                    std::min(m_pixels->size(), pixels->size()),
+                    pixels->begin());
+    }
+
+    m_pixels = std::move(pixels);
+    m_written = false;
+}
+
+//-------------------------------------------------------------------------
+
 void
 fb16::Image565::copy(
     const fb16::Interface565Base& i)
 {
-    m_dimensions = i.getDimensions();
-    m_buffer.reserve(m_dimensions.area());
+    // another image has the same layout, so its pixels can be shared
+
+    if (const auto* image = dynamic_cast<const Image565*>(&i))
+    {
+        share(*image);
+        return;
+    }
+
+    // copy straight into the pixels, which setDimensions() leaves
+    // unshared, rather than through getRow(), so the converted image can
+    // still be shared by its copies
+
+    setDimensions(i.getDimensions());
+
+    const auto width = static_cast<std::size_t>(m_dimensions.width());
+    const std::span<uint16_t> pixels{*m_pixels};
 
     for (auto y = 0 ; y < m_dimensions.height() ; ++y)
     {
-        auto destination = getRow(y);
-        auto source = i.getRow(y).subspan(0, m_dimensions.width());
-        std::ranges::copy(source, begin(destination));
+        auto source = i.getRow(y).subspan(0, width);
+        std::ranges::copy(source, pixels.begin() + (y * width));
     }
 }
 
 //-------------------------------------------------------------------------
 
+void
+fb16::Image565::share(
+    const Image565& image)
+{
+    // pixels that have been handed out for writing could be changed
+    // through a span taken earlier, so they are copied, not shared
+
+    m_dimensions = image.m_dimensions;
+    m_written = false;
+
+    if (image.m_written and image.m_pixels)
+    {
+        m_pixels = std::make_shared<Pixels>(*image.m_pixels);
+    }
+    else
+    {
+        m_pixels = image.m_pixels;
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+fb16::Image565::detach()
+{
+    m_pixels = std::make_shared<Pixels>(*m_pixels);
+}
+
+//-------------------------------------------------------------------------
+
 std::size_t
 fb16::Image565::offset(
     const Point565 p) const noexcept
@@ -32,6 +32,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <initializer_list>
+#include <memory>
 #include <optional>
 #include <span>
 #include <vector>
@@ -48,6 +49,23 @@ namespace fb16
 
 //-------------------------------------------------------------------------
 
+// An image in memory. Copies of an image that has not been written to
+// share its pixels, so copying an image loaded once (tiles, a splash
+// screen), or returning one by value, is cheap. The first time a copy
+// asks for its buffer to write to it is given pixels of its own (copy on
+// write), so getting the writable buffer of a shared image allocates,
+// and may throw std::bad_alloc.
+//
+// Once an image has handed out its writable buffer (getBuffer(), getRow()
+// or an Image565View of it), copies of it get pixels of their own
+// straight away, so a span taken from an image never writes into a copy
+// made later. Use Image565View for a cheap view of part of an image.
+//
+// Copies that share pixels may be read from different threads, but must
+// not be written, or asked for their writable buffer, from different
+// threads: whether to copy is decided from the shared pixels' use count,
+// which another thread may change at any time.
+
 class Image565
 :
     public Interface565Base
@@ -66,18 +84,35 @@ public:
 
     ~Image565() final = default;
 
-    Image565(const Image565&) = default;
+    Image565(const Image565& image);
     Image565(Image565&&) = default;
-    Image565& operator=(const Image565&) = default;
+    Image565& operator=(const Image565& image);
     Image565& operator=(Image565&&) = default;
 
     explicit Image565(const Interface565Base& i);
     Image565& operator=(const Interface565Base& i);
 
     [[nodiscard]] Dimensions565 getDimensions() const noexcept final { return m_dimensions; }
+    void setDimensions(Dimensions565 d);
+
+    [[nodiscard]] std::span<uint16_t>
+    getBuffer() & final
+    {
+        if (m_pixels.use_count() > 1)
+        {
+            detach();
+        }
+
+        m_written = true;
+
+        return (m_pixels) ? std::span<uint16_t>{*m_pixels} : std::span<uint16_t>{};
+    };
 
-    [[nodiscard]] std::span<uint16_t> getBuffer() & noexcept final { return m_buffer; };
-    [[nodiscard]] std::span<const uint16_t> getBuffer() const & noexcept final { return m_buffer; };
+    [[nodiscard]] std::span<const uint16_t>
+    getBuffer() const & noexcept final
+    {
+        return (m_pixels) ? std::span<const uint16_t>{*m_pixels} : std::span<const uint16_t>{};
+    };
 
     [[nodiscard]] std::span<uint16_t> getBuffer() && noexcept = delete;
     [[nodiscard]] std::span<const uint16_t> getBuffer() const && noexcept = delete;
@@ -85,12 +120,25 @@ public:
     [[nodiscard]] int getLineLengthPixels() const noexcept final { return m_dimensions.width(); };
     [[nodiscard]] std::size_t offset(const Point565 p) const noexcept final;
 
+    // True if the pixels are shared with another image.
+
+    [[nodiscard]] bool shared() const noexcept { return m_pixels.use_count() > 1; }
+
 private:
 
+    using Pixels = std::vector<uint16_t>;
+
     void copy(const Interface565Base& i);
+    void share(const Image565& image);
+    void detach();
 
     Dimensions565 m_dimensions;
-    std::vector<uint16_t> m_buffer{};
+    std::shared_ptr<Pixels> m_pixels{};
+
+    // the writable buffer has been handed out, so the pixels must not be
+    // shared with a copy
+
+    bool m_written{false};
 };
 
 //-------------------------------------------------------------------------
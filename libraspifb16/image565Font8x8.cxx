@@ -25,10 +25,13 @@
 //
 //-------------------------------------------------------------------------
 
+#include <array>
 #include <cstddef>
 
+#include "bitmapGlyph565.h"
 #include "image565.h"
 #include "image565Font8x8.h"
+#include "interface565Base.h"
 #include "point.h"
 #include "rgb565.h"
 
@@ -41,7 +44,6 @@ namespace fb16
 
 constexpr int sc_fontWidth{8};
 constexpr int sc_fontHeight{8};
-constexpr Dimensions565 sc_fontDimensions{ sc_fontWidth, sc_fontHeight};
 
 //-------------------------------------------------------------------------
 
@@ -2611,10 +2613,37 @@ constexpr uint8_t font[256][sc_fontHeight] =
 
 //-------------------------------------------------------------------------
 
+Image565Font8x8::Image565Font8x8()
+:
+    Image565Font8x8(BitmapFontStyle565{})
+{
+}
+
+//-------------------------------------------------------------------------
+
+Image565Font8x8::Image565Font8x8(
+    const BitmapFontStyle565& style)
+:
+    m_glyphs{std::span{&font[0][0], sizeof(font)}, sc_fontHeight, style}
+{
+}
+
+//-------------------------------------------------------------------------
+
 fb16::Dimensions565
 Image565Font8x8::getPixelDimensions() const noexcept
 {
-    return sc_fontDimensions;
+    return m_glyphs.getDimensions();
+}
+
+//-------------------------------------------------------------------------
+
+void
+Image565Font8x8::setStyle(
+    const BitmapFontStyle565& style)
+{
+    m_glyphs = BitmapGlyphs565{std::span{&font[0][0], sizeof(font)}, sc_fontHeight, style};
+    changed();
 }
 
 //-------------------------------------------------------------------------
@@ -2645,7 +2674,8 @@ Image565Font8x8::getStringDimensions(
         return Dimensions565{};
     }
 
-    Dimensions565 d{0, sc_fontHeight};
+    const auto cell = getPixelDimensions();
+    Dimensions565 d{0, cell.height()};
     auto pixelWidth{0};
 
     for (const auto c : s)
@@ -2653,12 +2683,12 @@ Image565Font8x8::getStringDimensions(
         if (c == '\n')
         {
             d.setWidth(std::max(d.width(), pixelWidth));
-            d.setHeight(d.height() + sc_fontHeight);
+            d.setHeight(d.height() + cell.height());
             pixelWidth = 0;
         }
         else
         {
-            pixelWidth += sc_fontWidth;
+            pixelWidth += cell.width();
         }
     }
 
@@ -2691,20 +2721,21 @@ Image565Font8x8::drawChar(
     const auto d = getPixelDimensions();
     const auto width = d.width();
 
-    for (auto j = 0 ; j < d.height() ; ++j)
+    if (auto* base = dynamic_cast<Interface565Base*>(&image))
     {
-        const auto byte = font[c][j];
+        m_glyphs.draw(*base, p, c, rgb);
+        return Point565(p.x() + width, p.y());
+    }
 
-        if (byte != 0)
+    for (auto j = 0 ; j < d.height() ; ++j)
+    {
+        for (auto i = 0 ; i < width ; ++i)
         {
-            for (auto i = 0 ; i < width ; ++i)
+            if (m_glyphs.isSet(c, i, j))
             {
-                if ((byte >> (width - i - 1)) & 1)
-                {
-                    image.setPixel(
-                        Point565(p.x() + i, p.y() + j),
-                        rgb);
-                }
+                image.setPixel(
+                    Point565(p.x() + i, p.y() + j),
+                    rgb);
             }
         }
     }
@@ -2714,6 +2745,51 @@ Image565Font8x8::drawChar(
 
 //-------------------------------------------------------------------------
 
+Point565
+Image565Font8x8::drawChar(
+    const Point565 p,
+    uint8_t c,
+    const RGB565& rgb,
+    const RGB565& background,
+    Interface565& image)
+{
+    return drawChar(p, c, rgb.get565(), background.get565(), image);
+}
+
+//-------------------------------------------------------------------------
+
+Point565
+Image565Font8x8::drawChar(
+    const Point565 p,
+    uint8_t c,
+    uint16_t rgb,
+    uint16_t background,
+    Interface565& image)
+{
+    const auto d = getPixelDimensions();
+    const auto width = d.width();
+
+    if (auto* base = dynamic_cast<Interface565Base*>(&image))
+    {
+        m_glyphs.draw(*base, p, c, rgb, background);
+        return Point565(p.x() + width, p.y());
+    }
+
+    for (auto j = 0 ; j < d.height() ; ++j)
+    {
+        for (auto i = 0 ; i < width ; ++i)
+        {
+            image.setPixel(
+                Point565(p.x() + i, p.y() + j),
+                (m_glyphs.isSet(c, i, j)) ? rgb : background);
+        }
+    }
+
+    return Point565(p.x() + width, p.y());
+}
+
+//-------------------------------------------------------------------------
+
 Point565
 Image565Font8x8::drawString(
     const Point565 p,
@@ -2736,6 +2812,7 @@ Image565Font8x8::drawString(
     const auto d = getPixelDimensions();
     Point565 position{p};
     const Point565 start{p};
+    auto* base = dynamic_cast<Interface565Base*>(&image);
 
     for (const auto c : sv)
     {
@@ -2747,7 +2824,14 @@ Image565Font8x8::drawString(
         }
         else
         {
-            drawChar(position, c, rgb, image);
+            if (base)
+            {
+                m_glyphs.draw(*base, position, static_cast<uint8_t>(c), rgb);
+            }
+            else
+            {
+                drawChar(position, c, rgb, image);
+            }
 
             position.set(
                 position.x() + d.width(),
@@ -2760,4 +2844,105 @@ Image565Font8x8::drawString(
 
 //-------------------------------------------------------------------------
 
+Point565
+Image565Font8x8::drawString(
+    const Point565 p,
+    std::string_view sv,
+    const RGB565& rgb,
+    const RGB565& background,
+    Interface565& image)
+{
+    return drawString(p, sv, rgb.get565(), background.get565(), image);
+}
+
+//-------------------------------------------------------------------------
+
+Point565
+Image565Font8x8::drawString(
+    const Point565 p,
+    std::string_view sv,
+    uint16_t rgb,
+    uint16_t background,
+    Interface565& image)
+{
+    const auto d = getPixelDimensions();
+    Point565 position{p};
+    auto* base = dynamic_cast<Interface565Base*>(&image);
+
+    for (const auto c : sv)
+    {
+        if (c == '\n')
+        {
+            position.set(p.x(), position.y() + d.height());
+        }
+        else
+        {
+            if (base)
+            {
+                m_glyphs.draw(*base,
+                               position,
+                               static_cast<uint8_t>(c),
+                               rgb,
+                               background);
+            }
+            else
+            {
+                drawChar(position, c, rgb, background, image);
+            }
+
+            position.translateX(d.width());
+        }
+    }
+
+    return position;
+}
+
+//-------------------------------------------------------------------------
+
+Point565
+Image565Font8x8::drawCoverage(
+    const Point565 p,
+    std::string_view sv,
+    const CoverageSink& sink)
+{
+    const auto d = getPixelDimensions();
+    const auto width = d.width();
+    std::array<uint8_t, sc_fontWidth * BitmapGlyphs565::c_maximumScale> coverage{};
+    const auto row = std::span{coverage}.first(width);
+    Point565 position{p};
+
+    for (const auto c : sv)
+    {
+        if (c == '\n')
+        {
+            position.set(p.x(), position.y() + d.height());
+        }
+        else
+        {
+            for (auto j = 0 ; j < d.height() ; ++j)
+            {
+                bool set{false};
+
+                for (auto i = 0 ; i < width ; ++i)
+                {
+                    const bool pixel = m_glyphs.isSet(static_cast<uint8_t>(c), i, j);
+                    row[i] = (pixel) ? 255 : 0;
+                    set = set or pixel;
+                }
+
+                if (set)
+                {
+                    sink(Point565(position.x(), position.y() + j), row, false);
+                }
+            }
+
+            position.translateX(width);
+        }
+    }
+
+    return position;
+}
+
+//-------------------------------------------------------------------------
+
 } // namespace fb16
@@ -32,6 +32,7 @@
 #include <cstdint>
 #include <string>
 
+#include "bitmapGlyph565.h"
 #include "interface565.h"
 #include "interface565Font.h"
 #include "point.h"
@@ -57,7 +58,8 @@ class Image565Font8x8 final
 {
 public:
 
-    Image565Font8x8() = default;
+    Image565Font8x8();
+    explicit Image565Font8x8(const BitmapFontStyle565& style);
     ~Image565Font8x8() final = default;
 
     Image565Font8x8(const Image565Font8x8&) = delete;
@@ -67,6 +69,12 @@ public:
 
     [[nodiscard]] Dimensions565 getPixelDimensions() const noexcept final;
 
+    // Scale, smooth, embolden or underline the font. The glyphs are
+    // expanded for the style once, here.
+
+    [[nodiscard]] const BitmapFontStyle565& getStyle() const noexcept { return m_glyphs.getStyle(); }
+    void setStyle(const BitmapFontStyle565& style);
+
     std::optional<char> getCharacterCode(CharacterCode code) const noexcept final;
 
     [[nodiscard]] Dimensions565 getStringDimensions(std::string_view s) final;
@@ -85,6 +93,25 @@ public:
         uint16_t rgb,
         Interface565& image) final;
 
+    // Draw with an opaque background, writing every pixel of each
+    // character cell.
+
+    Point565
+    drawChar(
+        const Point565 p,
+        uint8_t c,
+        const RGB565& rgb,
+        const RGB565& background,
+        Interface565& image);
+
+    Point565
+    drawChar(
+        const Point565 p,
+        uint8_t c,
+        uint16_t rgb,
+        uint16_t background,
+        Interface565& image);
+
     Point565
     drawString(
         const Point565 p,
@@ -98,6 +125,32 @@ public:
         std::string_view sv,
         uint16_t rgb,
         Interface565& image) final;
+
+    Point565
+    drawString(
+        const Point565 p,
+        std::string_view sv,
+        const RGB565& rgb,
+        const RGB565& background,
+        Interface565& image);
+
+    Point565
+    drawString(
+        const Point565 p,
+        std::string_view sv,
+        uint16_t rgb,
+        uint16_t background,
+        Interface565& image);
+
+    Point565
+    drawCoverage(
+        const Point565 p,
+        std::string_view sv,
+        const CoverageSink& sink) final;
+
+private:
+
+    BitmapGlyphs565 m_glyphs;
 };
 
 //-------------------------------------------------------------------------
@@ -0,0 +1,354 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <utility>
+
+#include "image565FontBaked.h"
+#include "interface565Base.h"
+#include "rgb565.h"
+#include "rgb565Kernels.h"
+#include "unicode.h"
+
+//=========================================================================
+
+fb16::Image565FontBaked::Image565FontBaked(
+    const BakedFont565& font)
+:
+    m_font(font),
+    m_missing{nullptr},
+    m_row{}
+{
+    m_missing = findGlyph('?');
+
+    uint16_t width{};
+
+    for (const auto& glyph : m_font.m_glyphs)
+    {
+        width = std::max(width, glyph.m_width);
+    }
+
+    m_row.resize(width);
+}
+
+//-------------------------------------------------------------------------
+
+std::string
+fb16::Image565FontBaked::getFontFamilyName() const
+{
+    return std::string(m_font.m_familyName);
+}
+
+//-------------------------------------------------------------------------
+
+std::string
+fb16::Image565FontBaked::getFontStyleName() const
+{
+    return std::string(m_font.m_styleName);
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Dimensions565
+fb16::Image565FontBaked::getPixelDimensions() const noexcept
+{
+    return Dimensions565(m_font.m_maxAdvance,
+                         m_font.m_ascender + m_font.m_descender);
+}
+
+//-------------------------------------------------------------------------
+
+std::optional<char>
+fb16::Image565FontBaked::getCharacterCode(
+    Interface565Font::CharacterCode code) const noexcept
+{
+    switch (code)
+    {
+        using enum Interface565Font::CharacterCode;
+
+    case DEGREE_SYMBOL:
+
+        return char(0xB0);
+    }
+
+    return {};
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Dimensions565
+fb16::Image565FontBaked::getStringDimensions(
+    std::string_view s)
+{
+    const auto p = layout(Point565{0, 0}, s, [](int, int, const BakedGlyph565&) {});
+    const auto d = getPixelDimensions();
+
+    return Dimensions565{p.x(), p.y() + d.height()};
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Point565
+fb16::Image565FontBaked::drawChar(
+    const Point565 p,
+    uint8_t c,
+    const RGB565& rgb,
+    Interface565& image)
+{
+    return drawString(p, std::string(1, c), rgb, image);
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Point565
+fb16::Image565FontBaked::drawChar(
+    const Point565 p,
+    uint8_t c,
+    uint16_t rgb,
+    Interface565& image)
+{
+    return drawChar(p, c, RGB565(rgb), image);
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Point565
+fb16::Image565FontBaked::drawString(
+    const Point565 p,
+    std::string_view sv,
+    const RGB565& rgb,
+    Interface565& image)
+{
+    return layout(p, sv, [&](int x, int y, const BakedGlyph565& glyph)
+    {
+        drawGlyph(x, y, glyph, rgb, image);
+    });
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Point565
+fb16::Image565FontBaked::drawString(
+    const Point565 p,
+    std::string_view sv,
+    uint16_t rgb,
+    Interface565& image)
+{
+    return drawString(p, sv, RGB565(rgb), image);
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Point565
+fb16::Image565FontBaked::drawCoverage(
+    const Point565 p,
+    std::string_view sv,
+    const CoverageSink& sink)
+{
+    return layout(p, sv, [&](int x, int y, const BakedGlyph565& glyph)
+    {
+        for (int j = 0 ; j < glyph.m_rows ; ++j)
+        {
+            sink(Point565{x, y + j}, unpackRow(glyph, j), false);
+        }
+    });
+}
+
+//-------------------------------------------------------------------------
+
+const fb16::BakedGlyph565*
+fb16::Image565FontBaked::findGlyph(
+    char32_t c) const noexcept
+{
+    const auto it = std::ranges::lower_bound(m_font.m_glyphs,
+                                             c,
+                                             {},
+                                             &BakedGlyph565::m_code);
+
+    if ((it != m_font.m_glyphs.end()) and (it->m_code == c))
+    {
+        return &*it;
+    }
+
+    return m_missing;
+}
+
+//-------------------------------------------------------------------------
+
+int
+fb16::Image565FontBaked::getKerning(
+    char32_t left,
+    char32_t right) const noexcept
+{
+    const auto key = [](const BakedKerning565& kerning)
+    {
+        return std::pair{kerning.m_left, kerning.m_right};
+    };
+
+    const auto it = std::ranges::lower_bound(m_font.m_kerning,
+                                             std::pair{left, right},
+                                             {},
+                                             key);
+
+    if ((it != m_font.m_kerning.end()) and (key(*it) == std::pair{left, right}))
+    {
+        return it->m_kerning;
+    }
+
+    return 0;
+}
+
+//-------------------------------------------------------------------------
+
+std::span<const uint8_t>
+fb16::Image565FontBaked::unpackRow(
+    const BakedGlyph565& glyph,
+    int j)
+{
+    const auto rowBytes = (glyph.m_width + 1) / 2;
+    const auto* packed = m_font.m_coverage.data() + glyph.m_offset + (j * rowBytes);
+
+    for (int i = 0 ; i < glyph.m_width ; ++i)
+    {
+        const auto byte = packed[i / 2];
+        const auto nibble = (i % 2 == 0) ? (byte >> 4) : (byte & 0x0F);
+
+        m_row[i] = static_cast<uint8_t>(nibble * 17);
+    }
+
+    return std::span{m_row}.first(glyph.m_width);
+}
+
+//-------------------------------------------------------------------------
+
+template<typename Draw>
+fb16::Point565
+fb16::Image565FontBaked::layout(
+    const Point565 p,
+    std::string_view sv,
+    Draw draw)
+{
+    const auto d = getPixelDimensions();
+
+    Point565 position{p};
+    position.translateY(m_font.m_ascender);
+
+    char32_t previous{0};
+    int overhang{0};
+
+    for (std::size_t i = 0 ; i < sv.size() ; )
+    {
+        const auto c = decodeUtf8(sv, i);
+
+        if (c == '\n')
+        {
+            position.set(p.x(), position.y() + d.height());
+            previous = 0;
+        }
+        else if (const auto* glyph = findGlyph(c))
+        {
+            if (previous)
+            {
+                position.translateX(getKerning(previous, glyph->m_code));
+            }
+
+            draw(position.x() + glyph->m_left,
+                 position.y() - glyph->m_top,
+                 *glyph);
+
+            position.translateX(glyph->m_advance);
+            overhang = glyph->m_width - glyph->m_advance;
+            previous = glyph->m_code;
+        }
+    }
+
+    if (overhang > 0)
+    {
+        position.translateX(overhang);
+    }
+
+    position.translateY(-m_font.m_ascender);
+
+    return position;
+}
+
+//-------------------------------------------------------------------------
+
+void
+fb16::Image565FontBaked::drawGlyph(
+    int xOffset,
+    int yOffset,
+    const BakedGlyph565& glyph,
+    const RGB565& rgb,
+    Interface565& image)
+{
+    if (auto* base = dynamic_cast<Interface565Base*>(&image))
+    {
+        const Rectangle565 area{Point565{xOffset, yOffset},
+                                Dimensions565{glyph.m_width, glyph.m_rows}};
+        const auto visible = base->getClip().intersection(area);
+
+        if (visible.empty())
+        {
+            return;
+        }
+
+        const auto& kernels = rgb565Kernels();
+        const auto xStart = visible.left() - xOffset;
+        const auto width = static_cast<std::size_t>(visible.width());
+
+        for (int j = visible.top() ; j <= visible.bottom() ; ++j)
+        {
+            kernels.blendCoverage(rgb.get565(),
+                                  unpackRow(glyph, j - yOffset).subspan(xStart, width),
+                                  base->getRow(j).subspan(visible.left(), width));
+        }
+
+        return;
+    }
+
+    for (int j = 0 ; j < glyph.m_rows ; ++j)
+    {
+        const auto row = unpackRow(glyph, j);
+
+        for (int i = 0 ; i < glyph.m_width ; ++i)
+        {
+            if (row[i])
+            {
+                const Point565 p{i + xOffset, j + yOffset};
+                auto background{image.getPixelRGB(p)};
+
+                if (background)
+                {
+                    image.setPixelRGB(p, rgb.blend(row[i], *background));
+                }
+            }
+        }
+    }
+}
+
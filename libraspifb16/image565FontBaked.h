@@ -0,0 +1,150 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "bakedFont565.h"
+#include "interface565.h"
+#include "interface565Font.h"
+#include "point.h"
+
+//-------------------------------------------------------------------------
+
+namespace fb16
+{
+
+//-------------------------------------------------------------------------
+
+class RGB565;
+
+//-------------------------------------------------------------------------
+
+// An anti-aliased font drawn from a BakedFont565 made by fontbake. It
+// lays text out as Image565FreeType does, from UTF-8, but the glyphs and
+// kerning are all in the baked data, so there is no FreeType at run time.
+// Characters that were not baked are drawn as '?' if that was.
+
+class Image565FontBaked final
+:
+    public Interface565Font
+{
+public:
+
+    explicit Image565FontBaked(const BakedFont565& font);
+    ~Image565FontBaked() final = default;
+
+    Image565FontBaked(const Image565FontBaked&) = delete;
+    Image565FontBaked(Image565FontBaked&&) = delete;
+    Image565FontBaked& operator=(const Image565FontBaked&) = delete;
+    Image565FontBaked& operator=(Image565FontBaked&&) = delete;
+
+    [[nodiscard]] std::string getFontFamilyName() const;
+    [[nodiscard]] std::string getFontStyleName() const;
+    [[nodiscard]] int getPixelSize() const noexcept { return m_font.m_pixelSize; }
+
+    [[nodiscard]] Dimensions565 getPixelDimensions() const noexcept final;
+
+    [[nodiscard]] std::optional<char> getCharacterCode(CharacterCode code) const noexcept final;
+
+    [[nodiscard]] Dimensions565 getStringDimensions(std::string_view s) final;
+
+    Point565
+    drawChar(
+        const Point565 p,
+        uint8_t c,
+        const RGB565& rgb,
+        Interface565& image) final;
+
+    Point565
+    drawChar(
+        const Point565 p,
+        uint8_t c,
+        uint16_t rgb,
+        Interface565& image) final;
+
+    Point565
+    drawString(
+        const Point565 p,
+        std::string_view sv,
+        const RGB565& rgb,
+        Interface565& image) final;
+
+    Point565
+    drawString(
+        const Point565 p,
+        std::string_view sv,
+        uint16_t rgb,
+        Interface565& image) final;
+
+    Point565
+    drawCoverage(
+        const Point565 p,
+        std::string_view sv,
+        const CoverageSink& sink) final;
+
+private:
+
+    [[nodiscard]] const BakedGlyph565* findGlyph(char32_t c) const noexcept;
+    [[nodiscard]] int getKerning(char32_t left, char32_t right) const noexcept;
+
+    // Expand row j of glyph to 8 bit coverage in m_row.
+
+    std::span<const uint8_t> unpackRow(const BakedGlyph565& glyph, int j);
+
+    // Lay out text from p, calling draw(x, y, glyph) with where each
+    // glyph's coverage goes.
+
+    template<typename Draw>
+    Point565 layout(const Point565 p, std::string_view sv, Draw draw);
+
+    void
+    drawGlyph(
+        int xOffset,
+        int yOffset,
+        const BakedGlyph565& glyph,
+        const RGB565& rgb,
+        Interface565& image);
+
+    BakedFont565 m_font;
+    const BakedGlyph565* m_missing;
+    std::vector<uint8_t> m_row;
+};
+
+//-------------------------------------------------------------------------
+
+} // namespace fb16
+
+//-------------------------------------------------------------------------
+
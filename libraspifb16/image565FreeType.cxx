@@ -25,10 +25,57 @@
 //
 //-------------------------------------------------------------------------
 
+#include <ft2build.h>
+#include <freetype/ftsizes.h>
+
+#include <algorithm>
 #include <stdexcept>
+#include <vector>
 
 #include "image565FreeType.h"
-#include "interface565Null.h"
+#include "interface565Base.h"
+#include "rgb565Kernels.h"
+#include "unicode.h"
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+constexpr uint64_t
+makeKey(
+    uint32_t high,
+    uint32_t low) noexcept
+{
+    return (static_cast<uint64_t>(high) << 32) | low;
+}
+
+//-------------------------------------------------------------------------
+
+// Blend each channel of foreground over background with its own alpha (as
+// RGB565::blend).
+
+fb16::RGB565
+blendLcd(
+    const uint8_t* alpha,
+    const fb16::RGB565& foreground,
+    const fb16::RGB565& background) noexcept
+{
+    auto blendChannel = [](uint8_t alpha, int a, int b) -> uint8_t
+    {
+        return ((a * alpha) + (b * (255 - alpha))) / 255;
+    };
+
+    return fb16::RGB565{blendChannel(alpha[0], foreground.getRed(), background.getRed()),
+                        blendChannel(alpha[1], foreground.getGreen(), background.getGreen()),
+                        blendChannel(alpha[2], foreground.getBlue(), background.getBlue())};
+}
+
+//-------------------------------------------------------------------------
+
+} // namespace
 
 //-------------------------------------------------------------------------
 
@@ -38,22 +85,23 @@ namespace fb16
 //-------------------------------------------------------------------------
 
 Image565FreeType::Image565FreeType(
-    const std::string& fontFile,
+    std::shared_ptr<FreeTypeFace> face,
     int pixelSize)
 :
     Image565FreeType()
 {
-    if (FT_Init_FreeType(&m_library) != 0)
-    {
-        throw std::invalid_argument("FreeType initialization faied");
-    }
+    addFace(std::move(face));
+    setPixelSize(pixelSize);
+}
 
-    if (FT_New_Face(m_library, fontFile.c_str(), 0, &m_face) != 0)
-    {
-        throw std::invalid_argument("FreeType could not open " + fontFile);
-    }
+//-------------------------------------------------------------------------
 
-    setPixelSize(pixelSize);
+Image565FreeType::Image565FreeType(
+    const std::string& fontFile,
+    int pixelSize)
+:
+    Image565FreeType(FontManager::getDefault().getFace(fontFile), pixelSize)
+{
 }
 
 //-------------------------------------------------------------------------
@@ -63,13 +111,22 @@ Image565FreeType::Image565FreeType(
 :
     Image565FreeType(fontConfig.m_fontFile, fontConfig.m_pixelHeight)
 {
+    setLcdRendering(fontConfig.m_lcdRendering);
+
+    for (const auto& fontFile : fontConfig.m_fallbackFontFiles)
+    {
+        addFallbackFont(fontFile);
+    }
 }
 
 //-------------------------------------------------------------------------
 
 Image565FreeType::~Image565FreeType()
 {
-    FT_Done_FreeType(m_library);
+    for (auto& face : m_faces)
+    {
+        FT_Done_Size(face.m_size);
+    }
 }
 
 //-------------------------------------------------------------------------
@@ -77,7 +134,7 @@ Image565FreeType::~Image565FreeType()
 std::string
 Image565FreeType::getFontFamilyName() const noexcept
 {
-    return m_face->family_name;
+    return getFace(0)->family_name;
 }
 
 //-------------------------------------------------------------------------
@@ -85,7 +142,7 @@ Image565FreeType::getFontFamilyName() const noexcept
 std::string
 Image565FreeType::getFontStyleName() const noexcept
 {
-    return m_face->style_name;
+    return getFace(0)->style_name;
 }
 
 //-------------------------------------------------------------------------
@@ -93,9 +150,9 @@ Image565FreeType::getFontStyleName() const noexcept
 Dimensions565
 Image565FreeType::getPixelDimensions() const noexcept
 {
-    const auto width = m_face->size->metrics.max_advance >> 6;
-    const auto height = (m_face->size->metrics.ascender +
-                         abs(m_face->size->metrics.descender)) >> 6;
+    const auto& metrics = m_faces.front().m_size->metrics;
+    const auto width = metrics.max_advance >> 6;
+    const auto height = (metrics.ascender + abs(metrics.descender)) >> 6;
     return Dimensions565(width, height);
 }
 
@@ -122,10 +179,7 @@ fb16::Dimensions565
 Image565FreeType::getStringDimensions(
     std::string_view s)
 {
-    constexpr RGB565 c{0};
-    Interface565Null n{};
-
-    Point565 p = drawString(Point565{0, 0}, s, c, n);
+    Point565 p = layout(Point565{0, 0}, s, false, [](int, int, const Glyph&) {});
 
     const auto d = getPixelDimensions();
 
@@ -138,10 +192,7 @@ fb16::Dimensions565
 Image565FreeType::getWideCharDimensions(
     uint32_t c)
 {
-    constexpr RGB565 rgb{0};
-    Interface565Null n{};
-
-    Point565 p = drawWideChar(Point565{0, 0}, c, rgb, n);
+    Point565 p = layoutWideChar(Point565{0, 0}, c, false, [](int, int, const Glyph&) {});
 
     const auto d = getPixelDimensions();
 
@@ -159,9 +210,21 @@ Image565FreeType::setPixelSize(
         return true;
     }
 
-    if (FT_Set_Pixel_Sizes(m_face, 0, pixelSize) == 0)
+    if (m_faces.empty())
     {
+        return false;
+    }
+
+    if (FT_Set_Pixel_Sizes(activateFace(0), 0, pixelSize) == 0)
+    {
+        for (uint32_t face = 1 ; face < m_faces.size() ; ++face)
+        {
+            FT_Set_Pixel_Sizes(activateFace(face), 0, pixelSize);
+        }
+
         m_pixelSize = pixelSize;
+        m_kerning.clear();
+        changed();
 
         return true;
     }
@@ -171,6 +234,62 @@ Image565FreeType::setPixelSize(
 
 //-------------------------------------------------------------------------
 
+void
+Image565FreeType::setLcdRendering(
+    bool lcd) noexcept
+{
+    if (lcd != m_lcdRendering)
+    {
+        m_lcdRendering = lcd;
+        changed();
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+Image565FreeType::addFallbackFont(
+    const std::string& fontFile)
+{
+    addFallbackFont(FontManager::getDefault().getFace(fontFile));
+}
+
+//-------------------------------------------------------------------------
+
+void
+Image565FreeType::addFallbackFont(
+    std::shared_ptr<FreeTypeFace> face)
+{
+    addFace(std::move(face));
+
+    if (m_pixelSize > 0)
+    {
+        FT_Set_Pixel_Sizes(activateFace(m_faces.size() - 1), 0, m_pixelSize);
+    }
+
+    // code points that were not found before may be in the new face
+
+    m_glyphSources.clear();
+    changed();
+}
+
+//-------------------------------------------------------------------------
+
+void
+Image565FreeType::setGlyphCacheSize(
+    std::size_t glyphs)
+{
+    m_glyphCacheSize = std::max(glyphs, std::size_t{1});
+
+    while (m_glyphs.size() > m_glyphCacheSize)
+    {
+        m_glyphLookup.erase(m_glyphs.back().m_key);
+        m_glyphs.pop_back();
+    }
+}
+
+//-------------------------------------------------------------------------
+
 Point565
 Image565FreeType::drawChar(
     const Point565 p,
@@ -202,134 +321,457 @@ Image565FreeType::drawWideChar(
     const RGB565& rgb,
     Interface565& image)
 {
-    Point565 position{p};
-    position.translateY(m_face->size->metrics.ascender >> 6);
-    const auto glyph_index{FT_Get_Char_Index(m_face, c)};
+    return layoutWideChar(p, c, true, [&](int x, int y, const Glyph& glyph)
+    {
+        drawGlyph(x, y, glyph, rgb, image);
+    });
+}
+
+//-------------------------------------------------------------------------
 
-    if (FT_Load_Glyph(m_face, glyph_index, FT_LOAD_RENDER) == 0)
+Point565
+Image565FreeType::drawString(
+    const Point565 p,
+    std::string_view sv,
+    const RGB565& rgb,
+    Interface565& image)
+{
+    return layout(p, sv, true, [&](int x, int y, const Glyph& glyph)
     {
-        const auto slot{m_face->glyph};
+        drawGlyph(x, y, glyph, rgb, image);
+    });
+}
 
-        drawChar(position.x() + slot->bitmap_left,
-                 position.y() - slot->bitmap_top,
-                 slot->bitmap,
-                 rgb,
-                 image);
+//-------------------------------------------------------------------------
 
-        position.translateX(slot->advance.x >> 6);
+Point565
+Image565FreeType::drawString(
+    const Point565 p,
+    std::string_view sv,
+    uint16_t rgb,
+    Interface565& image)
+{
+    return drawString(p, sv, RGB565(rgb), image);
+}
+
+//-------------------------------------------------------------------------
+
+Point565
+Image565FreeType::drawCoverage(
+    const Point565 p,
+    std::string_view sv,
+    const CoverageSink& sink)
+{
+    return layout(p, sv, true, [&](int x, int y, const Glyph& glyph)
+    {
+        emitCoverage(x, y, glyph, sink);
+    });
+}
+
+//-------------------------------------------------------------------------
+
+FT_Face
+Image565FreeType::getFace(
+    uint32_t face) const noexcept
+{
+    return m_faces[face].m_face->get();
+}
+
+//-------------------------------------------------------------------------
+
+FT_Face
+Image565FreeType::activateFace(
+    uint32_t face) const noexcept
+{
+    FT_Activate_Size(m_faces[face].m_size);
+
+    return getFace(face);
+}
+
+//-------------------------------------------------------------------------
+
+void
+Image565FreeType::addFace(
+    std::shared_ptr<FreeTypeFace> face)
+{
+    FT_Size size{};
+
+    if (FT_New_Size(face->get(), &size) != 0)
+    {
+        throw std::invalid_argument("FreeType could not create a size");
     }
 
-    position.translateY(-(m_face->size->metrics.ascender >> 6));
-    return position;
+    m_faces.push_back(Face{std::move(face), size});
+}
+
+//-------------------------------------------------------------------------
+
+Image565FreeType::GlyphSource
+Image565FreeType::getGlyphSource(
+    char32_t c)
+{
+    const auto it = m_glyphSources.find(c);
+
+    if (it != m_glyphSources.end())
+    {
+        return it->second;
+    }
+
+    // the font, then the fallbacks in order, then the bitmap font. If no
+    // font has the character, use the font's missing glyph.
+
+    GlyphSource source{0, FT_Get_Char_Index(getFace(0), c)};
+
+    for (uint32_t face = 1 ; (source.m_index == 0) and (face < m_faces.size()) ; ++face)
+    {
+        const auto index{FT_Get_Char_Index(getFace(face), c)};
+
+        if (index != 0)
+        {
+            source = GlyphSource{face, index};
+        }
+    }
+
+    if (source.m_index == 0)
+    {
+        if (const auto code = toCodePage437(c); code and (*code >= 0x20))
+        {
+            source = GlyphSource{c_bitmapFace, *code};
+        }
+    }
+
+    m_glyphSources.emplace(c, source);
+
+    return source;
+}
+
+//-------------------------------------------------------------------------
+
+const Image565FreeType::Glyph&
+Image565FreeType::getGlyph(
+    GlyphSource source,
+    bool render)
+{
+    const auto key = makeKey((source.m_face << 24) | (m_lcdRendering << 23) | m_pixelSize,
+                             source.m_index);
+    const auto it = m_glyphLookup.find(key);
+
+    if (it != m_glyphLookup.end())
+    {
+        m_glyphs.splice(m_glyphs.begin(), m_glyphs, it->second);
+
+        auto& glyph = m_glyphs.front();
+
+        if (render and glyph.m_loaded and not glyph.m_rendered)
+        {
+            loadGlyph(glyph, source, true);
+        }
+
+        return glyph;
+    }
+
+    //---------------------------------------------------------------------
+
+    Glyph glyph{key, false, false, false, 0, 0, 0, 0, 0, {}};
+    loadGlyph(glyph, source, render);
+
+    m_glyphs.push_front(std::move(glyph));
+    m_glyphLookup.emplace(key, m_glyphs.begin());
+
+    if (m_glyphs.size() > m_glyphCacheSize)
+    {
+        m_glyphLookup.erase(m_glyphs.back().m_key);
+        m_glyphs.pop_back();
+    }
+
+    return m_glyphs.front();
+}
+
+//-------------------------------------------------------------------------
+
+void
+Image565FreeType::loadGlyph(
+    Glyph& glyph,
+    GlyphSource source,
+    bool render)
+{
+    if (source.m_face == c_bitmapFace)
+    {
+        loadBitmapGlyph(glyph, source.m_index);
+        return;
+    }
+
+    // Without FT_LOAD_RENDER FreeType still sets the size and position the
+    // bitmap would have, so measuring a glyph does not rasterise it.
+
+    const auto target = (m_lcdRendering) ? FT_LOAD_TARGET_LCD : FT_LOAD_TARGET_NORMAL;
+    const auto flags = target | ((render) ? FT_LOAD_RENDER : FT_LOAD_DEFAULT);
+
+    if (FT_Load_Glyph(activateFace(source.m_face), source.m_index, flags) != 0)
+    {
+        glyph.m_loaded = false;
+        return;
+    }
+
+    const auto slot{getFace(source.m_face)->glyph};
+    const auto& bitmap{slot->bitmap};
+
+    // an LCD bitmap has three bytes, one per subpixel, for each pixel
+
+    const unsigned channels = (m_lcdRendering) ? 3 : 1;
+
+    glyph.m_loaded = true;
+    glyph.m_rendered = render;
+    glyph.m_lcd = m_lcdRendering;
+    glyph.m_left = slot->bitmap_left;
+    glyph.m_top = slot->bitmap_top;
+    glyph.m_width = bitmap.width / channels;
+    glyph.m_rows = bitmap.rows;
+    glyph.m_advance = slot->advance.x >> 6;
+
+    if (render)
+    {
+        glyph.m_coverage.resize(bitmap.width * bitmap.rows);
+
+        for (unsigned j = 0 ; j < bitmap.rows ; ++j)
+        {
+            const auto* row{bitmap.buffer + (j * bitmap.pitch)};
+
+            std::copy_n(row,
+                        bitmap.width,
+                        glyph.m_coverage.begin() + (j * bitmap.width));
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
+int
+Image565FreeType::getKerning(
+    GlyphSource left,
+    GlyphSource right)
+{
+    // only glyphs from the same face are kerned
+
+    if ((left.m_face != right.m_face) or
+        (left.m_face == c_bitmapFace) or
+        (left.m_index == 0) or
+        (right.m_index == 0))
+    {
+        return 0;
+    }
+
+    const auto key = makeKey((left.m_face << 16) | left.m_index, right.m_index);
+    const auto it = m_kerning.find(key);
+
+    if (it != m_kerning.end())
+    {
+        return it->second;
+    }
+
+    const auto face{activateFace(left.m_face)};
+    FT_Vector delta{};
+
+    if (FT_HAS_KERNING(face))
+    {
+        FT_Get_Kerning(face,
+                       left.m_index,
+                       right.m_index,
+                       ft_kerning_default,
+                       &delta);
+    }
+
+    const int kerning = delta.x >> 6;
+    m_kerning.emplace(key, kerning);
+
+    return kerning;
 }
 
 //-------------------------------------------------------------------------
 
+template<typename Draw>
 Point565
-Image565FreeType::drawString(
+Image565FreeType::layout(
     const Point565 p,
     std::string_view sv,
-    const RGB565& rgb,
-    Interface565& image)
+    bool render,
+    Draw draw)
 {
     const auto d = getPixelDimensions();
+    const auto ascender = m_faces.front().m_size->metrics.ascender >> 6;
+
     Point565 position{p};
-    position.translateY(m_face->size->metrics.ascender >> 6);
+    position.translateY(ascender);
 
-    auto slot{m_face->glyph};
-    const auto use_kerning{FT_HAS_KERNING(m_face)};
-    FT_UInt previous{0};
+    GlyphSource previous{0, 0};
 
-    for (const auto c : sv)
+    for (std::size_t i = 0 ; i < sv.size() ; )
     {
+        const auto c = decodeUtf8(sv, i);
+
         if (c == '\n')
         {
             position.set(p.x(), position.y() + d.height());
         }
         else
         {
-            const auto glyph_index{FT_Get_Char_Index(m_face, c)};
+            const auto source{getGlyphSource(c)};
 
-            if (use_kerning and previous and glyph_index)
-            {
-                FT_Vector delta;
+            position.translateX(getKerning(previous, source));
 
-                FT_Get_Kerning(m_face,
-                               previous,
-                               glyph_index,
-                               ft_kerning_default,
-                               &delta);
+            const auto& glyph = getGlyph(source, render);
 
-                position.translateX(delta.x >> 6);
-            }
-
-            if (FT_Load_Glyph(m_face, glyph_index, FT_LOAD_RENDER) == 0)
+            if (glyph.m_loaded)
             {
-                slot = m_face->glyph;
-
-                drawChar(position.x() + slot->bitmap_left,
-                        position.y() - slot->bitmap_top,
-                        slot->bitmap,
-                        rgb,
-                        image);
+                draw(position.x() + glyph.m_left,
+                     position.y() - glyph.m_top,
+                     glyph);
 
-                position.translateX(slot->advance.x >> 6);
-                previous = glyph_index;
+                position.translateX(glyph.m_advance);
+                m_lastOverhang = glyph.m_width - glyph.m_advance;
+                previous = source;
             }
         }
     }
 
     //-----------------------------------------------------------------
 
-    const auto advance{slot->bitmap.width - (slot->advance.x >> 6)};
-
-    if (advance > 0)
+    if (m_lastOverhang > 0)
     {
-        position.translateX(advance);
+        position.translateX(m_lastOverhang);
     }
 
-    position.translateY(-(m_face->size->metrics.ascender >> 6));
+    position.translateY(-ascender);
 
     return position;
 }
 
 //-------------------------------------------------------------------------
 
+template<typename Draw>
 Point565
-Image565FreeType::drawString(
+Image565FreeType::layoutWideChar(
     const Point565 p,
-    std::string_view sv,
-    uint16_t rgb,
-    Interface565& image)
+    uint32_t c,
+    bool render,
+    Draw draw)
 {
-    return drawString(p, sv, RGB565(rgb), image);
+    const auto ascender = m_faces.front().m_size->metrics.ascender >> 6;
+
+    Point565 position{p};
+    position.translateY(ascender);
+
+    const auto& glyph = getGlyph(getGlyphSource(c), render);
+
+    if (glyph.m_loaded)
+    {
+        draw(position.x() + glyph.m_left,
+             position.y() - glyph.m_top,
+             glyph);
+
+        position.translateX(glyph.m_advance);
+        m_lastOverhang = glyph.m_width - glyph.m_advance;
+    }
+
+    position.translateY(-ascender);
+    return position;
 }
 
 //-------------------------------------------------------------------------
 
 void
-Image565FreeType::drawChar(
+Image565FreeType::loadBitmapGlyph(
+    Glyph& glyph,
+    FT_UInt c)
+{
+    // the bitmap font's cell, with its baseline below the twelfth row
+
+    const auto d = m_bitmapFont.getPixelDimensions();
+
+    glyph.m_loaded = true;
+    glyph.m_rendered = true;
+    glyph.m_left = 0;
+    glyph.m_top = 12;
+    glyph.m_width = d.width();
+    glyph.m_rows = d.height();
+    glyph.m_advance = d.width();
+    glyph.m_coverage.assign(d.width() * d.height(), 0);
+
+    const std::string character(1, static_cast<char>(c));
+
+    m_bitmapFont.drawCoverage(Point565{0, 0},
+                              character,
+                              [&glyph](Point565 p, std::span<const uint8_t> coverage, bool)
+                              {
+                                  std::ranges::copy(coverage,
+                                                    glyph.m_coverage.begin() + (p.y() * glyph.m_width));
+                              });
+}
+
+//-------------------------------------------------------------------------
+
+void
+Image565FreeType::drawGlyph(
         int xOffset,
         int yOffset,
-        const FT_Bitmap& bitmap,
+        const Glyph& glyph,
         const RGB565& rgb,
         Interface565& image)
 {
-    for (unsigned j = 0 ; j < bitmap.rows ; ++j)
+    auto* base = dynamic_cast<Interface565Base*>(&image);
+
+    if (base)
+    {
+        // clip the glyph once, then blend each row of coverage into the
+        // destination row in one go
+
+        const Rectangle565 area{Point565{xOffset, yOffset},
+                                Dimensions565{glyph.m_width, glyph.m_rows}};
+        const auto visible = base->getClip().intersection(area);
+
+        if (visible.empty())
+        {
+            return;
+        }
+
+        const auto& kernels = rgb565Kernels();
+        const auto blend = (glyph.m_lcd) ? kernels.blendCoverageLcd
+                                         : kernels.blendCoverage;
+        const std::size_t channels = (glyph.m_lcd) ? 3 : 1;
+        const auto xStart = visible.left() - xOffset;
+        const auto width = static_cast<std::size_t>(visible.width());
+
+        for (int j = visible.top() ; j <= visible.bottom() ; ++j)
+        {
+            const auto* row{glyph.m_coverage.data() + ((j - yOffset) * glyph.m_width * channels)};
+
+            blend(rgb.get565(),
+                  std::span{row + (xStart * channels), width * channels},
+                  base->getRow(j).subspan(visible.left(), width));
+        }
+
+        return;
+    }
+
+    const int channels = (glyph.m_lcd) ? 3 : 1;
+
+    for (int j = 0 ; j < glyph.m_rows ; ++j)
     {
-        const auto* row{bitmap.buffer + (j * bitmap.pitch)};
+        const auto* row{glyph.m_coverage.data() + (j * glyph.m_width * channels)};
 
-        for (unsigned i = 0 ; i < bitmap.width ; ++i)
+        for (int i = 0 ; i < glyph.m_width ; ++i)
         {
-            if (row[i])
+            const auto* alpha{row + (i * channels)};
+
+            if (std::any_of(alpha, alpha + channels, [](uint8_t a) { return a != 0; }))
             {
-                const Point565 p{static_cast<int>(i + xOffset),
-                                      static_cast<int>(j + yOffset)};
+                const Point565 p{i + xOffset, j + yOffset};
                 auto background{image.getPixelRGB(p)};
 
                 if (background)
                 {
-                    image.setPixelRGB(p, rgb.blend(row[i], *background));
+                    image.setPixelRGB(p, (glyph.m_lcd) ? blendLcd(alpha, rgb, *background)
+                                                       : rgb.blend(*alpha, *background));
                 }
             }
         }
@@ -338,5 +780,25 @@ Image565FreeType::drawChar(
 
 //-------------------------------------------------------------------------
 
+void
+Image565FreeType::emitCoverage(
+    int xOffset,
+    int yOffset,
+    const Glyph& glyph,
+    const CoverageSink& sink) const
+{
+    const std::size_t channels = (glyph.m_lcd) ? 3 : 1;
+    const auto width = static_cast<std::size_t>(glyph.m_width) * channels;
+
+    for (int j = 0 ; j < glyph.m_rows ; ++j)
+    {
+        const std::span<const uint8_t> row{glyph.m_coverage.data() + (j * width), width};
+
+        sink(Point565{xOffset, j + yOffset}, row, glyph.m_lcd);
+    }
+}
+
+//-------------------------------------------------------------------------
+
 } // namespace fb16
 
@@ -32,11 +32,18 @@
 #include <ft2build.h>
 #include <freetype/freetype.h>
 
+#include <cstddef>
 #include <cstdint>
+#include <list>
+#include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "fontConfig.h"
+#include "fontManager.h"
 #include "image565.h"
+#include "image565Font8x16.h"
 #include "interface565Font.h"
 #include "point.h"
 
@@ -51,13 +58,36 @@ class RGB565;
 
 //-------------------------------------------------------------------------
 
+// Glyphs are rendered by FreeType once, then kept in a least recently
+// used cache keyed by glyph and pixel size, along with the glyph index of
+// each character and the kerning between pairs of glyphs. Measuring or
+// drawing text that has been drawn before does not call FreeType.
+// Measuring text only loads the metrics of glyphs it has not seen, so
+// nothing is rasterised until it is drawn.
+//
+// The font file is opened once, through a FontManager, and shared by every
+// Image565FreeType drawing it. Each has its own size and glyph cache.
+//
+// Strings are UTF-8. Each code point is looked for in the font, then in
+// each fallback font in the order they were added, then in the 8x16
+// bitmap font. Where it was found is cached, so the faces are only
+// searched once per code point.
+//
+// With LCD rendering on, glyphs are rendered at three times the horizontal
+// resolution for RGB stripe panels, filtered to reduce colour fringes, and
+// cached with a coverage for each of red, green and blue. Drawing blends
+// each channel with its own coverage, which keeps small text sharp.
+
 class Image565FreeType final
 :
     public Interface565Font
 {
 public:
 
+    static constexpr std::size_t c_defaultGlyphCacheSize{512};
+
     Image565FreeType() = default;
+    Image565FreeType(std::shared_ptr<FreeTypeFace> face, int pixelSize);
     Image565FreeType(const std::string& fontFile, int pixelSize);
     explicit Image565FreeType(const FontConfig& fontConfig);
     ~Image565FreeType() final;
@@ -84,6 +114,22 @@ public:
 
     bool setPixelSize(int pixelSize) noexcept;
 
+    // Render glyphs for a horizontal RGB stripe LCD panel. drawCoverage()
+    // passes the coverage of each of the three channels.
+
+    [[nodiscard]] bool getLcdRendering() const noexcept { return m_lcdRendering; }
+    void setLcdRendering(bool lcd) noexcept;
+
+    // Add a font to look in for characters this font does not have.
+
+    void addFallbackFont(const std::string& fontFile);
+    void addFallbackFont(std::shared_ptr<FreeTypeFace> face);
+
+    // The most glyphs kept rendered, over all pixel sizes (at least one).
+
+    [[nodiscard]] std::size_t getGlyphCacheSize() const noexcept { return m_glyphCacheSize; }
+    void setGlyphCacheSize(std::size_t glyphs);
+
     Point565
     drawChar(
         const Point565 p,
@@ -119,20 +165,106 @@ public:
         uint16_t rgb,
         Interface565& image) final;
 
+    Point565
+    drawCoverage(
+        const Point565 p,
+        std::string_view sv,
+        const CoverageSink& sink) final;
+
 private:
 
+    // Where the glyph for a code point comes from: the index of the face
+    // (0 for this font, then the fallbacks, or c_bitmapFace) and the
+    // glyph in it.
+
+    static constexpr uint32_t c_bitmapFace{0xFF};
+
+    struct GlyphSource
+    {
+        uint32_t m_face;
+        FT_UInt m_index;
+    };
+
+    // A glyph: its 8 bit coverage, one byte per pixel (three for an LCD
+    // glyph, red, green then blue) with no padding, the offset of the
+    // coverage from the pen position, and the distance to move the pen
+    // on. A glyph that has only been measured has its metrics, but no
+    // coverage until it is rendered.
+
+    struct Glyph
+    {
+        uint64_t m_key;
+        bool m_loaded;
+        bool m_rendered;
+        bool m_lcd;
+        int m_left;
+        int m_top;
+        int m_width;
+        int m_rows;
+        int m_advance;
+        std::vector<uint8_t> m_coverage;
+    };
+
+    // A face, and the size this font uses it at.
+
+    struct Face
+    {
+        std::shared_ptr<FreeTypeFace> m_face;
+        FT_Size m_size;
+    };
+
+    [[nodiscard]] FT_Face getFace(uint32_t face) const noexcept;
+
+    // Make this font's size current on a face before loading glyphs or
+    // kerning from it.
+
+    FT_Face activateFace(uint32_t face) const noexcept;
+
+    void addFace(std::shared_ptr<FreeTypeFace> face);
+    [[nodiscard]] GlyphSource getGlyphSource(char32_t c);
+    [[nodiscard]] const Glyph& getGlyph(GlyphSource source, bool render);
+    [[nodiscard]] int getKerning(GlyphSource left, GlyphSource right);
+
+    void loadGlyph(Glyph& glyph, GlyphSource source, bool render);
+    void loadBitmapGlyph(Glyph& glyph, FT_UInt c);
+
+    // Lay out text from p, calling draw(x, y, glyph) with where each
+    // glyph's coverage goes. Unless render is true, glyphs may be passed
+    // to draw without their coverage.
+
+    template<typename Draw>
+    Point565 layout(const Point565 p, std::string_view sv, bool render, Draw draw);
+
+    template<typename Draw>
+    Point565 layoutWideChar(const Point565 p, uint32_t c, bool render, Draw draw);
+
+    void emitCoverage(int xOffset, int yOffset, const Glyph& glyph, const CoverageSink& sink) const;
+
     void
-    drawChar(
+    drawGlyph(
         int xOffset,
         int yOffset,
-        const FT_Bitmap& bitmap,
+        const Glyph& glyph,
         const RGB565& rgb,
         Interface565& image);
 
     int m_pixelSize{};
+    bool m_lcdRendering{};
+
+    // how far the last glyph drawn extends past its advance
+
+    int m_lastOverhang{};
+
+    std::size_t m_glyphCacheSize{c_defaultGlyphCacheSize};
+    std::list<Glyph> m_glyphs{};
+    std::unordered_map<uint64_t, std::list<Glyph>::iterator> m_glyphLookup{};
+    std::unordered_map<char32_t, GlyphSource> m_glyphSources{};
+    std::unordered_map<uint64_t, int> m_kerning{};
+
+    // this font, then the fallbacks
 
-    FT_Face m_face{};
-    FT_Library m_library{};
+    std::vector<Face> m_faces{};
+    Image565Font8x16 m_bitmapFont{};
 };
 
 //-------------------------------------------------------------------------
@@ -26,13 +26,22 @@
 //-------------------------------------------------------------------------
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <numbers>
+#include <ranges>
 #include <span>
+#include <utility>
+#include <vector>
 
 #include "interface565.h"
 #include "image565Graphics.h"
+#include "paint565.h"
 #include "point.h"
+#include "rgb565Kernels.h"
 
 //=========================================================================
 
@@ -41,404 +50,1905 @@ namespace
 
 //-------------------------------------------------------------------------
 
+// Integer division rounding towards positive infinity, for a positive
+// denominator.
+
+constexpr int64_t
+divideCeiling(
+    int64_t numerator,
+    int64_t denominator) noexcept
+{
+    return (numerator >= 0)
+         ? (numerator + denominator - 1) / denominator
+         : -(-numerator / denominator);
+}
+
+//-------------------------------------------------------------------------
+
+// The part of a Bresenham line that can fall within the clip. The line is
+// stepped along its major axis, and step k (from 0) moves to major + k.
+// By then the minor axis has moved
+//
+//     m(k + 1) = ceil((2 * minor * (k + 1) - major) / (2 * major))
+//
+// pixels, which lets drawing start part way along the line with the same
+// state (minor steps and decision variable) as if it had started at the
+// beginning. The range of steps is found from the clip offsets along
+// each axis, relative to the first point. It is conservative, so pixels
+// must still be checked against the clip unless the whole line is inside.
+// The steps run from m_first up to, but not including, m_end.
+
+struct LineSteps
+{
+    int m_first;
+    int m_end;
+    int m_minor;
+    int64_t m_decision;
+};
+
+LineSteps
+lineSteps(
+    int major,
+    int minor,
+    int majorLow,
+    int majorHigh,
+    int minorLow,
+    int minorHigh)
+{
+    const auto ratio = static_cast<double>(major) / minor;
+    const auto limit = static_cast<double>(major);
+
+    auto toStep = [limit](double k)
+    {
+        return static_cast<int>(std::clamp(k, -1.0, limit));
+    };
+
+    LineSteps steps{};
+
+    steps.m_first = std::max({0,
+                              majorLow,
+                              toStep(std::floor((minorLow - 1) * ratio) - 1)});
+
+    const auto last = std::min({major - 1,
+                                majorHigh,
+                                toStep(std::ceil((minorHigh + 1) * ratio))});
+
+    steps.m_end = std::max(steps.m_first, last + 1);
+
+    const int64_t k = steps.m_first;
+
+    steps.m_minor = static_cast<int>(divideCeiling((2 * minor * k) - major,
+                                                   2 * int64_t{major}));
+    steps.m_decision = (2 * minor * (k + 1)) - major - (2 * int64_t{major} * steps.m_minor);
+
+    return steps;
+}
+
+//-------------------------------------------------------------------------
+
+// A polygon edge, stepped one scan line at a time. The x intersection on
+// scan line y is p1.x + (y - p1.y) * dx / dy, truncated, where p1 is the
+// first vertex of the edge. This is tracked exactly as a quotient and
+// remainder, so the result matches that division on every line.
+
+class PolygonEdge
+{
+public:
+
+    PolygonEdge(
+        const fb16::Point565& p1,
+        const fb16::Point565& p2)
+    :
+        m_x1{p1.x()},
+        m_y1{p1.y()},
+        m_yStart{std::min(p1.y(), p2.y())},
+        m_yEnd{std::max(p1.y(), p2.y())},
+        m_direction{(p2.y() > p1.y()) ? 1 : -1},
+        m_sign{(p2.x() < p1.x()) ? -1 : 1},
+        m_dx{std::abs(p2.x() - p1.x())},
+        m_dy{std::abs(p2.y() - p1.y())},
+        m_quotient{0},
+        m_remainder{0}
+    {
+    }
+
+    // Start on scan line y. The distance |y - y1| changes by m_direction
+    // as y increases, so (|y - y1| * dx) / dy is always non negative and
+    // truncation is the same as floor.
+
+    void
+    start(
+        int y)
+    {
+        const int64_t t = std::abs(y - m_y1);
+        const int64_t n = t * m_dx;
+
+        m_quotient = static_cast<int>(n / m_dy);
+        m_remainder = static_cast<int>(n % m_dy);
+    }
+
+    void
+    next() noexcept
+    {
+        if (m_direction > 0)
+        {
+            m_quotient += m_dx / m_dy;
+            m_remainder += m_dx % m_dy;
+
+            if (m_remainder >= m_dy)
+            {
+                m_remainder -= m_dy;
+                ++m_quotient;
+            }
+        }
+        else
+        {
+            m_quotient -= m_dx / m_dy;
+            m_remainder -= m_dx % m_dy;
+
+            if (m_remainder < 0)
+            {
+                m_remainder += m_dy;
+                --m_quotient;
+            }
+        }
+    }
+
+    [[nodiscard]] int direction() const noexcept { return m_direction; }
+    [[nodiscard]] int x() const noexcept { return m_x1 + (m_sign * m_quotient); }
+    [[nodiscard]] int yEnd() const noexcept { return m_yEnd; }
+    [[nodiscard]] int yStart() const noexcept { return m_yStart; }
+
+private:
+
+    int m_x1;
+    int m_y1;
+    int m_yStart;
+    int m_yEnd;
+    int m_direction;
+    int m_sign;
+    int m_dx;
+    int m_dy;
+    int m_quotient;
+    int m_remainder;
+};
+
+//-------------------------------------------------------------------------
+
+// The rows of a filled circle, passed to fillLine(x1, x2, y) as they are
+// found. The colour and paint versions of circleFilled() share this.
+
+template<typename FillLine>
+void
+circleFilledSpans(
+    fb16::Point565 p,
+    int r,
+    FillLine fillLine)
+{
+    auto lines = [&](int i, int j)
+    {
+        fillLine(p.x() + i, p.x() - i, p.y() + j);
+        fillLine(p.x() + i, p.x() - i, p.y() - j);
+    };
+
+    int j = r;
+    int d = 1 - r;
+
+    for (int i = 0 ; i <= j ; ++i)
+    {
+        if (d < 0)
+        {
+            d += (2 * i) + 3;
+        }
+        else
+        {
+            lines(i - 1, j);
+
+            d += (2 * (i - j)) + 5;
+            --j;
+        }
+    }
+
+    int i = j;
+
+    while (j > 0)
+    {
+        lines(i, j);
+
+        if (d < 0)
+        {
+            d += (2 * (i - j)) + 5;
+            ++i;
+        }
+        else
+        {
+            d += 3 - (2 * j);
+        }
+        --j;
+    }
+
+    lines(r - 1, 0);
+}
+
+//-------------------------------------------------------------------------
+
+// Scan convert a polygon, passing each span to fillLine(x1, x2, y). The
+// colour and paint versions of polygonFilled() share this.
+
+template<typename FillLine>
 void
-trim(
+polygonFilledSpans(
     const fb16::Interface565Base& iface,
-    fb16::Point565& p1,
-    fb16::Point565& p2)
+    std::span<const fb16::Point565> vertices,
+    fb16::FillRule rule,
+    FillLine fillLine)
+{
+    if (vertices.size() == 0)
+    {
+        return;
+    }
+
+    if (vertices.size() == 1)
+    {
+        fillLine(vertices[0].x(), vertices[0].x(), vertices[0].y());
+        return;
+    }
+
+    // Edge table, sorted by first scan line. Reused between calls.
+
+    thread_local std::vector<PolygonEdge> edges;
+    thread_local std::vector<PolygonEdge> active;
+
+    edges.clear();
+    active.clear();
+
+    for (std::size_t i = 0 ; i < vertices.size() ; ++i)
+    {
+        const auto& p1 = vertices[i];
+        const auto& p2 = vertices[(i + 1) % vertices.size()];
+
+        if (p1.y() != p2.y())
+        {
+            edges.emplace_back(p1, p2);
+        }
+    }
+
+    if (edges.empty())
+    {
+        return;
+    }
+
+    std::ranges::sort(edges, {}, &PolygonEdge::yStart);
+
+    //---------------------------------------------------------------------
+
+    const auto clip = iface.getClip();
+
+    auto yEnd = std::ranges::max(edges, {}, &PolygonEdge::yEnd).yEnd();
+    yEnd = std::min(yEnd, clip.bottom() + 1);
+
+    auto nextEdge = edges.begin();
+    auto y = std::max(nextEdge->yStart(), clip.top());
+
+    for ( ; y < yEnd ; ++y)
+    {
+        // retire finished edges, step the rest on to this scan line
+
+        std::erase_if(active, [y](const auto& edge) { return edge.yEnd() <= y; });
+
+        for (auto& edge : active)
+        {
+            edge.next();
+        }
+
+        // add edges that start on (or, when clipped, above) this line
+
+        for ( ; (nextEdge != edges.end()) and (nextEdge->yStart() <= y) ; ++nextEdge)
+        {
+            if (nextEdge->yEnd() > y)
+            {
+                active.push_back(*nextEdge);
+                active.back().start(y);
+            }
+        }
+
+        // the active list stays almost sorted from one line to the next
+
+        for (std::size_t i = 1 ; i < active.size() ; ++i)
+        {
+            for (auto j = i ; (j > 0) and (active[j].x() < active[j - 1].x()) ; --j)
+            {
+                std::swap(active[j], active[j - 1]);
+            }
+        }
+
+        //-----------------------------------------------------------------
+
+        if (rule == fb16::FillRule::EVEN_ODD)
+        {
+            for (std::size_t i = 0 ; (i + 1) < active.size() ; i += 2)
+            {
+                fillLine(active[i].x(), active[i + 1].x(), y);
+            }
+        }
+        else
+        {
+            int winding{0};
+            int xStart{0};
+
+            for (const auto& edge : active)
+            {
+                if (winding == 0)
+                {
+                    xStart = edge.x();
+                }
+
+                winding += edge.direction();
+
+                if (winding == 0)
+                {
+                    fillLine(xStart, edge.x(), y);
+                }
+            }
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
+// Paint pixels x1 to x2 of row y, clipped as horizontalLine() is.
+
+void
+paintSpan(
+    fb16::Interface565Base& iface,
+    const fb16::Paint565& paint,
+    int x1,
+    int x2,
+    int y)
+{
+    const auto clip = iface.getClip();
+
+    if ((y < clip.top()) or (y > clip.bottom()))
+    {
+        return;
+    }
+
+    if (x1 > x2)
+    {
+        std::swap(x1, x2);
+    }
+
+    x1 = std::max(x1, clip.left());
+    x2 = std::min(x2, clip.right());
+
+    if (x1 > x2)
+    {
+        return;
+    }
+
+    paint.fillSpan(iface.getRow(y).subspan(x1, x2 - x1 + 1), x1, y);
+}
+
+//-------------------------------------------------------------------------
+
+// Blend rgb into a pixel with an alpha from 0 to 255.
+
+void
+blendPixel(
+    uint16_t& pixel,
+    const fb16::RGB565& rgb,
+    int alpha)
+{
+    if (alpha <= 0)
+    {
+        return;
+    }
+
+    pixel = (alpha >= 255)
+          ? rgb.get565()
+          : rgb.blend(alpha, fb16::RGB565(pixel)).get565();
+}
+
+//-------------------------------------------------------------------------
+
+constexpr int
+coverageToAlpha(
+    float coverage) noexcept
+{
+    // written so that NaN gives no coverage
+
+    if (not (coverage > 0.0f))
+    {
+        return 0;
+    }
+
+    return static_cast<int>((std::min(coverage, 1.0f) * 255.0f) + 0.5f);
+}
+
+//-------------------------------------------------------------------------
+
+// The anti-aliased routines work in float and convert to int pixel
+// coordinates, which is undefined for values out of range. They draw
+// nothing for coordinates or sizes beyond this limit, or that are not
+// finite. Floats are only exact to the pixel up to 2^24 anyway, and the
+// limit leaves room for the arithmetic on the way to stay in int range.
+
+constexpr float c_floatLimit{1 << 24};
+
+constexpr bool
+inRange(
+    float value) noexcept
+{
+    return (value >= -c_floatLimit) and (value <= c_floatLimit);
+}
+
+constexpr bool
+inRange(
+    fb16::PointF p) noexcept
+{
+    return inRange(p.x()) and inRange(p.y());
+}
+
+//-------------------------------------------------------------------------
+
+// Xiaolin Wu's line, with sub-pixel end points. Intensity (0 to 1)
+// scales the coverage, for lines narrower than a pixel.
+
+void
+lineWu(
+    fb16::Interface565Base& iface,
+    fb16::PointF p1,
+    fb16::PointF p2,
+    const fb16::RGB565& rgb,
+    float intensity)
 {
-    if ((p1.x() == p2.x()) or (p1.y() == p2.y()))
+    if (not inRange(p1) or not inRange(p2))
+    {
+        return;
+    }
+
+    auto x1 = p1.x();
+    auto y1 = p1.y();
+    auto x2 = p2.x();
+    auto y2 = p2.y();
+
+    const bool steep = std::abs(y2 - y1) > std::abs(x2 - x1);
+
+    if (steep)
+    {
+        std::swap(x1, y1);
+        std::swap(x2, y2);
+    }
+
+    if (x1 > x2)
+    {
+        std::swap(x1, x2);
+        std::swap(y1, y2);
+    }
+
+    const auto clip = iface.getClip();
+    auto buffer = iface.getBuffer();
+
+    // The span below is clipped along the line, but the pixel either side
+    // of it may still fall outside of the clip.
+
+    auto plot = [&](int i, int j, float coverage)
+    {
+        const auto p = (steep) ? fb16::Point565{j, i} : fb16::Point565{i, j};
+
+        if (clip.contains(p))
+        {
+            blendPixel(buffer[iface.offset(p)],
+                       rgb,
+                       coverageToAlpha(coverage * intensity));
+        }
+    };
+
+    const auto dx = x2 - x1;
+    const auto gradient = (dx == 0.0f) ? 1.0f : (y2 - y1) / dx;
+
+    // end points, weighted by how much of their pixel they cover
+
+    auto endPoint = [&](float x, float y, float xGap) -> int
+    {
+        const auto xEnd = std::round(x);
+        const auto yEnd = y + (gradient * (xEnd - x));
+        const auto yPixel = std::floor(yEnd);
+        const auto yFraction = yEnd - yPixel;
+        const auto i = static_cast<int>(xEnd);
+        const auto j = static_cast<int>(yPixel);
+
+        plot(i, j, (1.0f - yFraction) * xGap);
+        plot(i, j + 1, yFraction * xGap);
+
+        return i;
+    };
+
+    const auto xStart = endPoint(x1, y1, 1.0f - ((x1 + 0.5f) - std::floor(x1 + 0.5f)));
+    const auto xEnd = endPoint(x2, y2, (x2 + 0.5f) - std::floor(x2 + 0.5f));
+
+    //---------------------------------------------------------------------
+    // The span between the end points, clipped and stepped in 16.16 fixed
+    // point.
+
+    const auto iFirst = std::max(xStart + 1, (steep) ? clip.top() : clip.left());
+    const auto iLast = std::min(xEnd - 1, (steep) ? clip.bottom() : clip.right());
+
+    if (iFirst > iLast)
     {
         return;
     }
 
-    const auto id = iface.getDimensions();
+    const auto yFirst = y1 + (gradient * (xStart + 1 - x1));
+    const auto gradientFixed = static_cast<int64_t>(std::round(gradient * 65536.0f));
+
+    auto yFixed = static_cast<int64_t>(std::floor(yFirst * 65536.0f)) +
+                  ((iFirst - xStart - 1) * gradientFixed);
+
+    for (auto i = iFirst ; i <= iLast ; ++i)
+    {
+        const auto j = static_cast<int>(yFixed >> 16);
+        const auto fraction = static_cast<float>(yFixed & 0xFFFF) / 65536.0f;
+
+        plot(i, j, 1.0f - fraction);
+        plot(i, j + 1, fraction);
+
+        yFixed += gradientFixed;
+    }
+}
+
+//-------------------------------------------------------------------------
+
+// Span filled shapes. A pixel is filled when its centre lies inside the
+// shape, with left and top edges inclusive and right and bottom edges
+// exclusive, so that shapes sharing an edge leave no gap between them.
+
+constexpr int c_spanMin{std::numeric_limits<int>::min() / 2};
+constexpr int c_spanMax{std::numeric_limits<int>::max() / 2};
+
+constexpr float c_miterLimit{4.0f};
+
+//-------------------------------------------------------------------------
+
+int
+toSpan(
+    double value) noexcept
+{
+    return static_cast<int>(std::clamp(value,
+                                       static_cast<double>(c_spanMin),
+                                       static_cast<double>(c_spanMax)));
+}
+
+//-------------------------------------------------------------------------
+
+// The first pixel with its centre at or after edge.
+
+int
+firstCentre(
+    double edge) noexcept
+{
+    return toSpan(std::ceil(edge));
+}
+
+//-------------------------------------------------------------------------
+
+// The last pixel with its centre before edge.
+
+int
+lastCentre(
+    double edge) noexcept
+{
+    return toSpan(std::ceil(edge)) - 1;
+}
+
+//-------------------------------------------------------------------------
+
+struct Span
+{
+    int x1;
+    int x2;
+
+    [[nodiscard]] constexpr bool empty() const noexcept { return x1 > x2; }
+
+    [[nodiscard]] constexpr Span
+    intersection(
+        const Span& s) const noexcept
+    {
+        return {std::max(x1, s.x1), std::min(x2, s.x2)};
+    }
+};
+
+//-------------------------------------------------------------------------
+
+void
+fillSpan(
+    fb16::Interface565Base& iface,
+    const Span& span,
+    int y,
+    uint16_t rgb)
+{
+    if (not span.empty())
+    {
+        fb16::horizontalLine(iface, span.x1, span.x2, y, rgb);
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+fillConvex(
+    fb16::Interface565Base& iface,
+    std::span<const fb16::PointF> vertices,
+    uint16_t rgb)
+{
+    const auto [minY, maxY] = std::ranges::minmax(vertices | std::views::transform(&fb16::PointF::y));
+    const auto clip = iface.getClip();
+
+    const auto yFirst = std::max(firstCentre(minY), clip.top());
+    const auto yLast = std::min(lastCentre(maxY), clip.bottom());
+
+    for (auto y = yFirst; y <= yLast; ++y)
+    {
+        auto left = std::numeric_limits<float>::max();
+        auto right = std::numeric_limits<float>::lowest();
+
+        for (std::size_t i = 0; i < vertices.size(); ++i)
+        {
+            const auto& a = vertices[i];
+            const auto& b = vertices[(i + 1) % vertices.size()];
+            const auto fy = static_cast<float>(y);
+
+            if (((a.y() <= fy) and (b.y() > fy)) or
+                ((b.y() <= fy) and (a.y() > fy)))
+            {
+                const auto x = a.x() + ((fy - a.y()) * (b.x() - a.x()) / (b.y() - a.y()));
+
+                left = std::min(left, x);
+                right = std::max(right, x);
+            }
+        }
+
+        if (left < right)
+        {
+            fillSpan(iface, {firstCentre(left), lastCentre(right)}, y, rgb);
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+fillDisc(
+    fb16::Interface565Base& iface,
+    fb16::PointF centre,
+    float r,
+    uint16_t rgb)
+{
+    const auto clip = iface.getClip();
+
+    const auto yFirst = std::max(firstCentre(centre.y() - r), clip.top());
+    const auto yLast = std::min(lastCentre(centre.y() + r), clip.bottom());
+
+    for (auto y = yFirst; y <= yLast; ++y)
+    {
+        const auto dy = y - centre.y();
+        const auto dx = std::sqrt(std::max((r * r) - (dy * dy), 0.0f));
+
+        fillSpan(iface,
+                 {firstCentre(centre.x() - dx), lastCentre(centre.x() + dx)},
+                 y,
+                 rgb);
+    }
+}
+
+//-------------------------------------------------------------------------
+
+// The pixels on a row, dy below the centre, that are on the clockwise
+// side of (or on) the ray from the centre in direction (ux, uy). When
+// strict, the pixels on the ray itself are excluded.
+
+Span
+halfPlane(
+    double ux,
+    double uy,
+    int cx,
+    int dy,
+    bool strict) noexcept
+{
+    if (uy == 0.0)
+    {
+        const auto side = ux * dy;
+        const bool inside = (strict) ? (side > 0.0) : (side >= 0.0);
+
+        return (inside) ? Span{c_spanMin, c_spanMax} : Span{c_spanMax, c_spanMin};
+    }
+
+    const auto edge = cx + (ux * dy / uy);
+
+    if (uy > 0.0)
+    {
+        return {c_spanMin, (strict) ? toSpan(std::ceil(edge)) - 1 : toSpan(std::floor(edge))};
+    }
+
+    return {(strict) ? toSpan(std::floor(edge)) + 1 : toSpan(std::ceil(edge)), c_spanMax};
+}
+
+//-------------------------------------------------------------------------
+
+// A unit vector at angle degrees, snapped so that multiples of 90 degrees
+// are exact.
+
+fb16::Point<double>
+direction(
+    double degrees) noexcept
+{
+    const auto radians = degrees * std::numbers::pi / 180.0;
+
+    auto snap = [](double value)
+    {
+        return (std::abs(value) < 1.0e-12) ? 0.0 : value;
+    };
+
+    return {snap(std::cos(radians)), snap(std::sin(radians))};
+}
+
+//-------------------------------------------------------------------------
+
+// The part of a ring, from radius inner to outer, that lies in the sector
+// sweeping clockwise from startAngle.
+
+void
+fillRingSector(
+    fb16::Interface565Base& iface,
+    fb16::Point565 centre,
+    float inner,
+    float outer,
+    float startAngle,
+    float sweep,
+    uint16_t rgb)
+{
+    const auto clip = iface.getClip();
+    const auto cx = centre.x();
+
+    const auto yFirst = std::max(firstCentre(centre.y() - outer), clip.top());
+    const auto yLast = std::min(lastCentre(centre.y() + outer), clip.bottom());
+
+    const auto u0 = direction(startAngle);
+    const auto u1 = direction(startAngle + sweep);
+
+    for (auto y = yFirst; y <= yLast; ++y)
+    {
+        const auto dy = y - centre.y();
+        const auto dy2 = static_cast<float>(dy) * dy;
+        const auto xOuter = std::sqrt(std::max((outer * outer) - dy2, 0.0f));
+
+        // pixels from inner up to, but not including, outer from the
+        // centre, so that the ring is symmetric about the centre
+
+        std::array<Span, 2> ring
+        {
+            Span{toSpan(std::floor(cx - xOuter)) + 1, lastCentre(cx + xOuter)},
+            Span{c_spanMax, c_spanMin}
+        };
+
+        if ((inner > 0.0f) and ((inner * inner) > dy2))
+        {
+            const auto xInner = std::sqrt((inner * inner) - dy2);
+
+            ring[1] = Span{firstCentre(cx + xInner), ring[0].x2};
+            ring[0].x2 = toSpan(std::floor(cx - xInner));
+        }
+
+        std::array<Span, 2> sector
+        {
+            Span{c_spanMin, c_spanMax},
+            Span{c_spanMax, c_spanMin}
+        };
+
+        if (sweep <= 180.0f)
+        {
+            sector[0] = halfPlane(u0.x(), u0.y(), cx, dy, false)
+                       .intersection(halfPlane(-u1.x(), -u1.y(), cx, dy, false));
+        }
+        else if (sweep < 360.0f)
+        {
+            // outside of the sector is a sector of less than 180 degrees
+
+            const auto outside = halfPlane(u1.x(), u1.y(), cx, dy, true)
+                                .intersection(halfPlane(-u0.x(), -u0.y(), cx, dy, true));
+
+            if (not outside.empty())
+            {
+                sector[0] = Span{c_spanMin, outside.x1 - 1};
+                sector[1] = Span{outside.x2 + 1, c_spanMax};
+            }
+        }
+
+        for (const auto& r : ring)
+        {
+            for (const auto& s : sector)
+            {
+                fillSpan(iface, r.intersection(s), y, rgb);
+            }
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
+// Sweep in degrees, clockwise from startAngle to endAngle, in the range
+// (0, 360]. Equal angles give a full circle.
+
+float
+sweepAngle(
+    float startAngle,
+    float endAngle) noexcept
+{
+    if (startAngle == endAngle)
+    {
+        return 360.0f;
+    }
+
+    auto sweep = std::fmod(endAngle - startAngle, 360.0f);
+
+    if (sweep <= 0.0f)
+    {
+        sweep += 360.0f;
+    }
+
+    return sweep;
+}
+
+//-------------------------------------------------------------------------
+
+// One segment of a thick line, with its end caps.
+
+void
+strokeSegment(
+    fb16::Interface565Base& iface,
+    fb16::PointF p1,
+    fb16::PointF p2,
+    float halfWidth,
+    fb16::LineCap startCap,
+    fb16::LineCap endCap,
+    uint16_t rgb)
+{
+    using fb16::LineCap;
+    using fb16::PointF;
+
+    const auto dx = p2.x() - p1.x();
+    const auto dy = p2.y() - p1.y();
+    const auto length = std::hypot(dx, dy);
+
+    // a zero length line is drawn as its caps would be, square pointing
+    // along the x axis
+
+    const auto ux = (length == 0.0f) ? 1.0f : dx / length;
+    const auto uy = (length == 0.0f) ? 0.0f : dy / length;
+
+    const auto nx = -uy * halfWidth;
+    const auto ny = ux * halfWidth;
+
+    const auto s1 = (startCap == LineCap::SQUARE) ? halfWidth : 0.0f;
+    const auto s2 = (endCap == LineCap::SQUARE) ? halfWidth : 0.0f;
+
+    const PointF a{p1.x() - (ux * s1), p1.y() - (uy * s1)};
+    const PointF b{p2.x() + (ux * s2), p2.y() + (uy * s2)};
+
+    const std::array<PointF, 4> quad
+    {
+        PointF{a.x() + nx, a.y() + ny},
+        PointF{b.x() + nx, b.y() + ny},
+        PointF{b.x() - nx, b.y() - ny},
+        PointF{a.x() - nx, a.y() - ny}
+    };
+
+    fillConvex(iface, quad, rgb);
+
+    if (startCap == LineCap::ROUND)
+    {
+        fillDisc(iface, p1, halfWidth, rgb);
+    }
+
+    if (endCap == LineCap::ROUND)
+    {
+        fillDisc(iface, p2, halfWidth, rgb);
+    }
+}
+
+//-------------------------------------------------------------------------
+
+// Fill the gap on the outside of the corner where two segments of a
+// thick polyline meet at vertex.
+
+void
+strokeJoin(
+    fb16::Interface565Base& iface,
+    fb16::PointF previous,
+    fb16::PointF vertex,
+    fb16::PointF next,
+    float halfWidth,
+    fb16::LineJoin join,
+    uint16_t rgb)
+{
+    using fb16::LineJoin;
+    using fb16::PointF;
+
+    if (join == LineJoin::ROUND)
+    {
+        fillDisc(iface, vertex, halfWidth, rgb);
+        return;
+    }
+
+    const auto dx1 = vertex.x() - previous.x();
+    const auto dy1 = vertex.y() - previous.y();
+    const auto dx2 = next.x() - vertex.x();
+    const auto dy2 = next.y() - vertex.y();
+
+    const auto turn = (dx1 * dy2) - (dy1 * dx2);
+
+    if (turn == 0.0f)
+    {
+        return;
+    }
+
+    // normals on the outside of the corner
+
+    const auto side = ((turn > 0.0f) ? -halfWidth : halfWidth);
+    const auto length1 = std::hypot(dx1, dy1);
+    const auto length2 = std::hypot(dx2, dy2);
+
+    const auto nx1 = -dy1 * side / length1;
+    const auto ny1 = dx1 * side / length1;
+    const auto nx2 = -dy2 * side / length2;
+    const auto ny2 = dx2 * side / length2;
+
+    const PointF o1{vertex.x() + nx1, vertex.y() + ny1};
+    const PointF o2{vertex.x() + nx2, vertex.y() + ny2};
+
+    if (join == LineJoin::MITER)
+    {
+        // the miter point is along n1 + n2, at a half width from both
+        // outside edges
+
+        const auto denominator = (halfWidth * halfWidth) + (nx1 * nx2) + (ny1 * ny2);
+
+        if (denominator > 0.0f)
+        {
+            const auto k = (halfWidth * halfWidth) / denominator;
+            const auto mx = k * (nx1 + nx2);
+            const auto my = k * (ny1 + ny2);
+
+            if (std::hypot(mx, my) <= (c_miterLimit * halfWidth))
+            {
+                const std::array<PointF, 4> miter
+                {
+                    vertex,
+                    o1,
+                    PointF{vertex.x() + mx, vertex.y() + my},
+                    o2
+                };
+
+                fillConvex(iface, miter, rgb);
+                return;
+            }
+        }
+    }
+
+    const std::array<PointF, 3> bevel{vertex, o1, o2};
+    fillConvex(iface, bevel, rgb);
+}
+
+//-------------------------------------------------------------------------
+
+// The inclusive extent of a rounded rectangle on row y, where the radius
+// has already been limited to half the shorter side.
+
+Span
+roundedRow(
+    const fb16::Rectangle565& rect,
+    int radius,
+    int y)
+{
+    auto dy = 0;
+
+    if (y < (rect.top() + radius))
+    {
+        dy = rect.top() + radius - y;
+    }
+    else if (y > (rect.bottom() - radius))
+    {
+        dy = y - (rect.bottom() - radius);
+    }
+
+    if (dy == 0)
+    {
+        return {rect.left(), rect.right()};
+    }
+
+    const auto r = radius + 0.5f;
+    const auto dx = static_cast<int>(std::sqrt(std::max((r * r) - (static_cast<float>(dy) * dy), 0.0f)));
+    const auto inset = radius - dx;
+
+    return {rect.left() + inset, rect.right() - inset};
+}
+
+//-------------------------------------------------------------------------
+
+int
+limitRadius(
+    const fb16::Rectangle565& rect,
+    int radius) noexcept
+{
+    return std::clamp(radius, 0, std::min(rect.width(), rect.height()) / 2);
+}
+
+//-------------------------------------------------------------------------
+
+} // namespace
+
+//=========================================================================
+
+namespace fb16
+{
+
+//-------------------------------------------------------------------------
+
+void
+box(
+    Interface565Base& iface,
+    Point565 p1,
+    Point565 p2,
+    uint16_t rgb)
+{
+    // each side is clipped, so sides outside the clip are not drawn
+
+    verticalLine(iface, p1.x(), p1.y(), p2.y(), rgb);
+    horizontalLine(iface, p1.x(), p2.x(), p1.y(), rgb);
+    verticalLine(iface, p2.x(), p1.y(), p2.y(), rgb);
+    horizontalLine(iface, p1.x(), p2.x(), p2.y(), rgb);
+}
+
+//-------------------------------------------------------------------------
+
+void
+boxFilled(
+    Interface565Base& iface,
+    Point565 p1,
+    Point565 p2,
+    uint16_t rgb)
+{
+    const auto area = iface.getClip().intersection(Rectangle565{p1, p2});
+
+    if (area.empty())
+    {
+        return;
+    }
+
+    const auto& kernels = rgb565Kernels();
+    const auto fill = (iface.deviceMemory()) ? kernels.fillStream : kernels.fill;
+
+    for (auto y = area.top(); y <= area.bottom(); ++y)
+    {
+        fill(rgb, iface.getRow(y).subspan(area.left(), area.width()));
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+boxFilled(
+    Interface565Base& iface,
+    Point565 p1,
+    Point565 p2,
+    const RGB565& rgb,
+    uint8_t alpha)
+{
+    const auto area = iface.getClip().intersection(Rectangle565{p1, p2});
+
+    if (area.empty())
+    {
+        return;
+    }
+
+    const auto& kernels = rgb565Kernels();
+
+    for (auto j = area.top() ; j <= area.bottom() ; ++j)
+    {
+        kernels.blend(rgb.get565(),
+                      alpha,
+                      iface.getRow(j).subspan(area.left(), area.width()));
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+boxFilled(
+    Interface565Base& iface,
+    Point565 p1,
+    Point565 p2,
+    const Paint565& paint)
+{
+    const auto area = iface.getClip().intersection(Rectangle565{p1, p2});
+
+    if (area.empty())
+    {
+        return;
+    }
+
+    for (auto y = area.top(); y <= area.bottom(); ++y)
+    {
+        paint.fillSpan(iface.getRow(y).subspan(area.left(), area.width()), area.left(), y);
+    }
+}
+
+//=========================================================================
+
+void
+line(
+    Interface565Base& iface,
+    Point565 p1,
+    Point565 p2,
+    uint16_t rgb)
+{
+    const auto clip = iface.getClip();
+    const auto bounds = clip.intersection(Rectangle565{p1, p2});
+
+    if (bounds.empty())
+    {
+        return;
+    }
+
+    if (p1.y() == p2.y())
+    {
+        horizontalLine(iface, p1.x(), p2.x(), p1.y(), rgb);
+        return;
+    }
+
+    if (p1.x() == p2.x())
+    {
+        verticalLine(iface, p1.x(), p1.y(), p2.y(), rgb);
+        return;
+    }
+
+    // Every pixel of the line is within the rectangle spanned by its end
+    // points, so when that is inside the clip there is nothing to check.
+
+    const bool inside = clip.contains(Rectangle565{p1, p2});
+    auto buffer = iface.getBuffer();
+
+    auto plot = [&](const Point565 p)
+    {
+        if (inside or clip.contains(p))
+        {
+            buffer[iface.offset(p)] = rgb;
+        }
+    };
+
+    const auto dx = std::abs(p2.x() - p1.x());
+    const auto dy = std::abs(p2.y() - p1.y());
+
+    if (dx > dy)
+    {
+        if (p1.x() > p2.x())
+        {
+            std::swap(p1, p2);
+        }
+
+        const auto sign_y = (p1.y() <= p2.y()) ? 1 : -1;
+        const auto range = lineSteps(dx,
+                                     dy,
+                                     clip.left() - p1.x(),
+                                     clip.right() - p1.x(),
+                                     (sign_y > 0) ? clip.top() - p1.y() : p1.y() - clip.bottom(),
+                                     (sign_y > 0) ? clip.bottom() - p1.y() : p1.y() - clip.top());
+
+        auto y = p1.y() + (sign_y * range.m_minor);
+        auto d = range.m_decision;
+        const int64_t incrE = 2 * dy;
+        const int64_t incrNE = 2 * (dy - dx);
+
+        if ((2 * dy - dx) > 0)
+        {
+            plot(p1);
+        }
+
+        for (auto x = p1.x() + range.m_first; x != p1.x() + range.m_end; ++x)
+        {
+            if (d <= 0)
+            {
+                d += incrE;
+            }
+            else
+            {
+                d += incrNE;
+                y += sign_y;
+            }
+
+            plot(Point565(x, y));
+        }
+    }
+    else
+    {
+        if (p1.y() > p2.y())
+        {
+            std::swap(p1, p2);
+        }
+
+        const auto sign_x = (p1.x() <= p2.x()) ? 1 : -1;
+        const auto range = lineSteps(dy,
+                                     dx,
+                                     clip.top() - p1.y(),
+                                     clip.bottom() - p1.y(),
+                                     (sign_x > 0) ? clip.left() - p1.x() : p1.x() - clip.right(),
+                                     (sign_x > 0) ? clip.right() - p1.x() : p1.x() - clip.left());
+
+        auto x = p1.x() + (sign_x * range.m_minor);
+        auto d = range.m_decision;
+        const int64_t incrN = 2 * dx;
+        const int64_t incrNE = 2 * (dx - dy);
+
+        if ((2 * dx - dy) > 0)
+        {
+            plot(p1);
+        }
+
+        for (auto y = p1.y() + range.m_first; y != p1.y() + range.m_end; ++y)
+        {
+            if (d <= 0)
+            {
+                d += incrN;
+            }
+            else
+            {
+                d += incrNE;
+                x += sign_x;
+            }
+
+            plot(Point565(x, y));
+        }
+    }
+}
 
-    const auto minX = std::min(p1.x(), p2.x());
-    const auto maxX = std::max(p1.x(), p2.x());
+//-------------------------------------------------------------------------
 
-    const auto minY = std::min(p1.y(), p2.y());
-    const auto maxY = std::max(p1.y(), p2.y());
+void
+horizontalLine(
+    Interface565Base& iface,
+    int x1,
+    int x2,
+    int y,
+    uint16_t rgb)
+{
+    const auto clip = iface.getClip();
 
-    if ((minX > 0) and
-        (maxX < id.width()) and
-        (minY > 0) and
-        (maxY < id.height()))
+    if ((y < clip.top()) or (y > clip.bottom()))
     {
         return;
     }
 
-    if (p1.y() > p2.y())
+    if (x1 > x2)
     {
-        std::swap(p1, p2);
+        std::swap(x1, x2);
     }
 
-    auto rise = p2.y() - p1.y();
-    auto run = p2.x() - p1.x();
-    auto c = p1.y() - (rise * p1.x()) / run;
+    x1 = std::max(x1, clip.left());
+    x2 = std::min(x2, clip.right());
 
-    if (p1.y() < 0)
+    if (x1 > x2)
     {
-        p1.setY(0);
-        p1.setX((p1.y() - c) * run / rise);
+        return;
     }
 
-    if (p2.y() >= id.height())
+    const auto& kernels = rgb565Kernels();
+    const auto fill = (iface.deviceMemory()) ? kernels.fillStream : kernels.fill;
+
+    fill(rgb, iface.getRow(y).subspan(x1, x2 - x1 + 1));
+}
+
+//-------------------------------------------------------------------------
+
+void
+verticalLine(
+    Interface565Base& iface,
+    int x,
+    int y1,
+    int y2,
+    uint16_t rgb)
+{
+    const auto clip = iface.getClip();
+
+    if ((x < clip.left()) or (x > clip.right()))
     {
-        p2.setY(id.height() - 1);
-        p2.setX((p2.y() - c) * run / rise);
+        return;
     }
 
-    if (p1.x() > p2.x())
+    if (y1 > y2)
     {
-        std::swap(p1, p2);
-
+        std::swap(y1, y2);
     }
 
-    rise = p2.y() - p1.y();
-    run = p2.x() - p1.x();
-    c = p1.y() - (rise * p1.x()) / run;
+    y1 = std::max(y1, clip.top());
+    y2 = std::min(y2, clip.bottom());
 
-    if (p1.x() < 0)
+    if (y1 > y2)
     {
-        p1.setX(0);
-        p1.setY((rise * p1.x()) / run + c);
+        return;
     }
 
-    if (p2.x() >= id.width())
+    auto buffer = iface.getBuffer();
+    const auto stride = iface.getLineLengthPixels();
+    auto ost = iface.offset(Point565(x, y1));
+
+    for (auto y = y1; y <= y2; ++y, ost += stride)
     {
-        p2.setX(id.width() - 1);
-        p2.setY((rise * p2.x()) / run + c);
+        buffer[ost] = rgb;
     }
 }
 
-//-------------------------------------------------------------------------
+//=========================================================================
 
-} // namespace
+void
+circlePoints(
+    Interface565Base& iface,
+    bool inside,
+    int x,
+    int y,
+    int i,
+    int j,
+    uint16_t rgb)
+{
+    auto buffer = iface.getBuffer();
+
+    auto plot = [&](const Point565 p)
+    {
+        if (inside)
+        {
+            buffer[iface.offset(p)] = rgb;
+        }
+        else
+        {
+            iface.setPixel(p, rgb);
+        }
+    };
+
+    plot(Point(x + i, y + j));
+    plot(Point(x - i, y + j));
+    plot(Point(x + i, y - j));
+    plot(Point(x - i, y - j));
+
+    if (i != j)
+    {
+        plot(Point(x + j, y + i));
+        plot(Point(x + j, y - i));
+        plot(Point(x - j, y + i));
+        plot(Point(x - j, y - i));
+    }
+}
 
 //=========================================================================
 
-namespace fb16
+void
+circle(
+    Interface565Base& iface,
+    Point565 p,
+    int r,
+    uint16_t rgb)
 {
+    const Rectangle565 bounds{Point565{p.x() - r, p.y() - r},
+                              Point565{p.x() + r, p.y() + r}};
+    const bool inside = iface.getClip().contains(bounds);
+
+    int j = r;
+    int d = 1 - r;
+    int deltaE = 3;
+    int deltaSE = -2 * r + 5;
+
+    for (int i = 0 ;  i <= j ; ++i)
+    {
+        circlePoints(iface, inside, p.x(), p.y(), i, j, rgb);
+
+        deltaE += 2;
+        if (d < 0)
+        {
+            d += deltaE;
+            deltaSE += 2;
+        }
+        else
+        {
+            d += deltaSE;
+            deltaSE += 4;
+            --j;
+        }
+    }
+}
 
 //-------------------------------------------------------------------------
 
 void
-box(
+circleFilled(
     Interface565Base& iface,
-    Point565 p1,
-    Point565 p2,
+    Point565 p,
+    int r,
     uint16_t rgb)
 {
-    trim(iface, p1, p2);
-    verticalLine(iface, p1.x(), p1.y(), p2.y(), rgb);
-    horizontalLine(iface, p1.x(), p2.x(), p1.y(), rgb);
-    verticalLine(iface, p2.x(), p1.y(), p2.y(), rgb);
-    horizontalLine(iface, p1.x(), p2.x(), p2.y(), rgb);
+    circleFilledSpans(p, r, [&](int x1, int x2, int y)
+    {
+        horizontalLine(iface, x1, x2, y, rgb);
+    });
 }
 
 //-------------------------------------------------------------------------
 
 void
-boxFilled(
+circleFilled(
     Interface565Base& iface,
-    Point565 p1,
-    Point565 p2,
+    Point565 p,
+    int r,
+    const Paint565& paint)
+{
+    circleFilledSpans(p, r, [&](int x1, int x2, int y)
+    {
+        paintSpan(iface, paint, x1, x2, y);
+    });
+}
+
+//=========================================================================
+
+void
+polygon(
+    Interface565Base& iface,
+    std::span<const Point565> vertices,
     uint16_t rgb)
 {
-    trim(iface, p1, p2);
+    if (vertices.size() == 0)
+    {
+        return;
+    }
 
-    if (p1.y() > p2.y())
+    if (vertices.size() == 1)
     {
-        std::swap(p1, p2);
+        iface.setPixel(vertices[0], rgb);
+        return;
     }
 
-    for (auto y = p1.y(); y <= p2.y(); ++y)
+    for (std::size_t i = 0; i < vertices.size(); ++i)
     {
-         horizontalLine(iface, p1.x(), p2.x(), y, rgb);
+        const auto& p1 = vertices[i];
+        const auto& p2 = vertices[(i + 1) % vertices.size()];
+
+        line(iface, p1, p2, rgb);
     }
 }
 
 //-------------------------------------------------------------------------
 
 void
-boxFilled(
+polygonFilled(
     Interface565Base& iface,
-    Point565 p1,
-    Point565 p2,
-    const RGB565& rgb,
-    uint8_t alpha)
+    std::span<const Point565> vertices,
+    uint16_t rgb,
+    FillRule rule)
 {
-    trim(iface, p1, p2);
+    polygonFilledSpans(iface, vertices, rule, [&](int x1, int x2, int y)
+    {
+        horizontalLine(iface, x1, x2, y, rgb);
+    });
+}
 
-    Point565 pa{std::min(p1.x(), p2.x()), std::min(p1.y(), p2.y())};
-    Point565 pb{std::max(p1.x(), p2.x()), std::max(p1.y(), p2.y())};
+//-------------------------------------------------------------------------
 
-    for (auto j = pa.y() ; j <= pb.y() ; ++j)
+void
+polygonFilled(
+    Interface565Base& iface,
+    std::span<const Point565> vertices,
+    const Paint565& paint,
+    FillRule rule)
+{
+    polygonFilledSpans(iface, vertices, rule, [&](int x1, int x2, int y)
     {
-        for (auto i = pa.x() ; i <= pb.x() ; ++i)
-        {
-            const Point p{i, j};
-            auto background = iface.getPixelRGB(p);
+        paintSpan(iface, paint, x1, x2, y);
+    });
+}
 
-            if (background.has_value())
-            {
-                iface.setPixelRGB(p, rgb.blend(alpha, *background));
-            }
-        }
+//-------------------------------------------------------------------------
+
+void
+polyline(
+    Interface565Base& iface,
+    std::span<const Point565> vertices,
+    uint16_t rgb)
+{
+    if (vertices.size() == 0)
+    {
+        return;
+    }
+
+    if (vertices.size() == 1)
+    {
+        iface.setPixel(vertices[0], rgb);
+        return;
+    }
+
+    for (std::size_t i = 0; i < vertices.size() - 1; ++i)
+    {
+        const auto& p1 = vertices[i];
+        const auto& p2 = vertices[i + 1];
+
+        line(iface, p1, p2, rgb);
     }
 }
 
 //=========================================================================
 
 void
-line(
+lineThick(
     Interface565Base& iface,
     Point565 p1,
     Point565 p2,
-    uint16_t rgb)
+    int width,
+    uint16_t rgb,
+    LineCap cap)
 {
-    trim(iface, p1, p2);
-
-    const auto id = iface.getDimensions();
-    const auto minX = std::min(p1.x(), p2.x());
-    const auto maxX = std::max(p1.x(), p2.x());
-
-    if ((maxX < 0) or (minX >= id.width()))
+    if (width <= 0)
     {
         return;
     }
 
-    const auto minY = std::min(p1.y(), p2.y());
-    const auto maxY = std::max(p1.y(), p2.y());
-
-    if ((maxY < 0) or (minY >= id.height()))
+    if (width == 1)
     {
+        line(iface, p1, p2, rgb);
         return;
     }
 
-    if (p1.y() == p2.y())
+    strokeSegment(iface,
+                  PointF(p1.x(), p1.y()),
+                  PointF(p2.x(), p2.y()),
+                  width / 2.0f,
+                  cap,
+                  cap,
+                  rgb);
+}
+
+//-------------------------------------------------------------------------
+
+void
+polylineThick(
+    Interface565Base& iface,
+    std::span<const Point565> vertices,
+    int width,
+    uint16_t rgb,
+    LineJoin join,
+    LineCap cap)
+{
+    if ((width <= 0) or (vertices.size() == 0))
     {
-        horizontalLine(iface, p1.x(), p2.x(), p1.y(), rgb);
         return;
     }
 
-    if (p1.x() == p2.x())
+    if (width == 1)
     {
-        verticalLine(iface, p1.x(), p1.y(), p2.y(), rgb);
+        polyline(iface, vertices, rgb);
         return;
     }
 
-    const auto dx = std::abs(p2.x() - p1.x());
-    const auto dy = std::abs(p2.y() - p1.y());
+    // repeated vertices would have no direction to join along
 
-    if (dx > dy)
+    std::vector<PointF> points;
+    points.reserve(vertices.size());
+
+    for (std::size_t i = 0; i < vertices.size(); ++i)
     {
-        if (p1.x() > p2.x())
+        if ((i == 0) or (vertices[i] != vertices[i - 1]))
         {
-            std::swap(p1, p2);
+            points.emplace_back(vertices[i].x(), vertices[i].y());
         }
+    }
 
-        const auto sign_y = (p1.y() <= p2.y()) ? 1 : -1;
-        auto y = p1.y();
-        auto d = 2 * dy - dx;
-        const auto incrE = 2 * dy;
-        const auto incrNE = 2 * (dy - dx);
+    const auto halfWidth = width / 2.0f;
 
-        if (d > 0)
-        {
-            iface.setPixel(p1, rgb);
-        }
+    if (points.size() == 1)
+    {
+        strokeSegment(iface, points[0], points[0], halfWidth, cap, cap, rgb);
+        return;
+    }
 
-        for (auto x = p1.x(); x != p2.x(); ++x)
-        {
-            if (d <= 0)
-            {
-                d += incrE;
-            }
-            else
-            {
-                d += incrNE;
-                y += sign_y;
-            }
+    const auto last = points.size() - 1;
 
-            iface.setPixel(Point(x, y), rgb);
-        }
-    }
-    else
+    for (std::size_t i = 0; i < last; ++i)
     {
-        if (p1.y() > p2.y())
-        {
-            std::swap(p1, p2);
-        }
+        strokeSegment(iface,
+                      points[i],
+                      points[i + 1],
+                      halfWidth,
+                      (i == 0) ? cap : LineCap::BUTT,
+                      (i + 1 == last) ? cap : LineCap::BUTT,
+                      rgb);
+    }
 
-        const auto sign_x = (p1.x() <= p2.x()) ? 1 : -1;
-        auto x = p1.x();
-        auto d = 2 * dx - dy;
-        const auto incrN = 2 * dx;
-        const auto incrNE = 2 * (dx - dy);
+    for (std::size_t i = 1; i < last; ++i)
+    {
+        strokeJoin(iface,
+                   points[i - 1],
+                   points[i],
+                   points[i + 1],
+                   halfWidth,
+                   join,
+                   rgb);
+    }
+}
 
-        if (d > 0)
-        {
-            iface.setPixel(p1, rgb);
-        }
+//-------------------------------------------------------------------------
 
-        for (auto y = p1.y(); y != p2.y(); ++y)
-        {
-            if (d <= 0)
-            {
-                d += incrN;
-            }
-            else
-            {
-                d += incrNE;
-                x += sign_x;
-            }
+void
+circleThick(
+    Interface565Base& iface,
+    Point565 p,
+    int r,
+    int width,
+    uint16_t rgb)
+{
+    if ((r < 0) or (width <= 0))
+    {
+        return;
+    }
 
-            iface.setPixel(Point(x, y), rgb);
-        }
+    if (width == 1)
+    {
+        circle(iface, p, r, rgb);
+        return;
     }
+
+    const auto halfWidth = width / 2.0f;
+
+    fillRingSector(iface, p, r - halfWidth, r + halfWidth, 0.0f, 360.0f, rgb);
 }
 
 //-------------------------------------------------------------------------
 
 void
-horizontalLine(
+arc(
     Interface565Base& iface,
-    int x1,
-    int x2,
-    int y,
+    Point565 p,
+    int r,
+    float startAngle,
+    float endAngle,
+    int width,
     uint16_t rgb)
 {
-    const auto id = iface.getDimensions();
-
-    if ((y < 0) or (y >= id.height()))
+    if ((r < 0) or (width <= 0))
     {
         return;
     }
 
-    if (x1 > x2)
-    {
-        std::swap(x1, x2);
-    }
+    const auto halfWidth = width / 2.0f;
+
+    fillRingSector(iface,
+                   p,
+                   r - halfWidth,
+                   r + halfWidth,
+                   startAngle,
+                   sweepAngle(startAngle, endAngle),
+                   rgb);
+}
 
-    x1 = std::max(x1, 0);
-    x2 = std::min(x2, id.width() - 1);
+//-------------------------------------------------------------------------
 
-    if ((x1 >= id.width()) or (x2 < 0))
+void
+arcFilled(
+    Interface565Base& iface,
+    Point565 p,
+    int r,
+    float startAngle,
+    float endAngle,
+    uint16_t rgb)
+{
+    if (r < 0)
     {
         return;
     }
 
-    std::span<uint16_t> row = iface.getRow(y).subspan(x1, x2 - x1 + 1);
-    std::fill(begin(row), end(row), rgb);
+    fillRingSector(iface,
+                   p,
+                   0.0f,
+                   r + 0.5f,
+                   startAngle,
+                   sweepAngle(startAngle, endAngle),
+                   rgb);
 }
 
 //-------------------------------------------------------------------------
 
 void
-verticalLine(
+boxRounded(
     Interface565Base& iface,
-    int x,
-    int y1,
-    int y2,
+    Point565 p1,
+    Point565 p2,
+    int radius,
+    int width,
     uint16_t rgb)
 {
-    const auto id = iface.getDimensions();
+    const Rectangle565 outer{p1, p2};
 
-    if (x < 0 or x >= id.width())
+    if (width <= 0)
     {
         return;
     }
 
-    if (y1 > y2)
+    if ((2 * width) >= std::min(outer.width(), outer.height()))
     {
-        std::swap(y1, y2);
+        boxRoundedFilled(iface, p1, p2, radius, rgb);
+        return;
     }
 
-    y1 = std::max(y1, 0);
-    y2 = std::min(y2, id.height() - 1);
-
-    if ((y1 >= id.height()) or (y2 < 0))
+    const Rectangle565 inner
     {
-        return;
-    }
+        Point565{outer.left() + width, outer.top() + width},
+        Dimensions565{outer.width() - (2 * width), outer.height() - (2 * width)}
+    };
+
+    const auto outerRadius = limitRadius(outer, radius);
+    const auto innerRadius = limitRadius(inner, outerRadius - width);
 
-    for (auto y = y1; y <= y2; ++y)
+    const auto clip = iface.getClip();
+    const auto yFirst = std::max(outer.top(), clip.top());
+    const auto yLast = std::min(outer.bottom(), clip.bottom());
+
+    for (auto y = yFirst; y <= yLast; ++y)
     {
-        iface.setPixel(Point(x, y), rgb);
+        const auto o = roundedRow(outer, outerRadius, y);
+
+        if ((y < inner.top()) or (y > inner.bottom()))
+        {
+            fillSpan(iface, o, y, rgb);
+            continue;
+        }
+
+        const auto i = roundedRow(inner, innerRadius, y);
+
+        fillSpan(iface, {o.x1, i.x1 - 1}, y, rgb);
+        fillSpan(iface, {i.x2 + 1, o.x2}, y, rgb);
     }
 }
 
-//=========================================================================
+//-------------------------------------------------------------------------
 
 void
-circleLines(
+boxRoundedFilled(
     Interface565Base& iface,
-    int x,
-    int y,
-    int i,
-    int j,
+    Point565 p1,
+    Point565 p2,
+    int radius,
     uint16_t rgb)
 {
-    horizontalLine(iface, x + i, x - i, y + j, rgb);
-    horizontalLine(iface, x + i, x - i, y - j, rgb);
+    const Rectangle565 rect{p1, p2};
+    const auto r = limitRadius(rect, radius);
+
+    const auto clip = iface.getClip();
+    const auto yFirst = std::max(rect.top(), clip.top());
+    const auto yLast = std::min(rect.bottom(), clip.bottom());
+
+    for (auto y = yFirst; y <= yLast; ++y)
+    {
+        fillSpan(iface, roundedRow(rect, r, y), y, rgb);
+    }
 }
 
-//-------------------------------------------------------------------------
+//=========================================================================
 
 void
-circlePoints(
+lineAntiAliased(
     Interface565Base& iface,
-    int x,
-    int y,
-    int i,
-    int j,
-    uint16_t rgb)
+    PointF p1,
+    PointF p2,
+    uint16_t rgb,
+    float width)
 {
-    iface.setPixel(Point(x + i, y + j), rgb);
-    iface.setPixel(Point(x - i, y + j), rgb);
-    iface.setPixel(Point(x + i, y - j), rgb);
-    iface.setPixel(Point(x - i, y - j), rgb);
+    if (not inRange(p1) or
+        not inRange(p2) or
+        not inRange(width) or
+        (width <= 0.0f))
+    {
+        return;
+    }
 
-    if (i != j)
+    if (width <= 1.0f)
+    {
+        lineWu(iface, p1, p2, RGB565{rgb}, width);
+        return;
+    }
+
+    // wider lines are drawn as a (rotated) rectangle with square ends
+
+    const auto dx = p2.x() - p1.x();
+    const auto dy = p2.y() - p1.y();
+    const auto length = std::hypot(dx, dy);
+
+    if (length == 0.0f)
     {
-        iface.setPixel(Point(x + j, y + i), rgb);
-        iface.setPixel(Point(x + j, y - i), rgb);
-        iface.setPixel(Point(x - j, y + i), rgb);
-        iface.setPixel(Point(x - j, y - i), rgb);
+        return;
     }
+
+    const auto nx = -dy * width / (2.0f * length);
+    const auto ny = dx * width / (2.0f * length);
+
+    const std::array<PointF, 4> vertices
+    {
+        PointF{p1.x() + nx, p1.y() + ny},
+        PointF{p2.x() + nx, p2.y() + ny},
+        PointF{p2.x() - nx, p2.y() - ny},
+        PointF{p1.x() - nx, p1.y() - ny}
+    };
+
+    polygonFilledAntiAliased(iface, vertices, rgb);
 }
 
-//=========================================================================
+//-------------------------------------------------------------------------
 
 void
-circle(
+circleAntiAliased(
     Interface565Base& iface,
-    Point565 p,
-    int r,
-    uint16_t rgb)
+    PointF p,
+    float r,
+    uint16_t rgb,
+    float width)
 {
-    int j = r;
-    int d = 1 - r;
-    int deltaE = 3;
-    int deltaSE = -2 * r + 5;
+    if (not inRange(p) or
+        not inRange(r) or
+        not inRange(width) or
+        (r < 0.0f) or
+        (width <= 0.0f))
+    {
+        return;
+    }
 
-    for (int i = 0 ;  i <= j ; ++i)
+    // coverage falls off over half a pixel either side of the ring
+
+    const auto inner = std::max(r - (width / 2.0f), 0.0f);
+    const auto outer = r + (width / 2.0f);
+
+    const auto innerLimit = inner - 0.5f;
+    const auto outerLimit = outer + 0.5f;
+
+    const auto clip = iface.getClip();
+    const RGB565 colour{rgb};
+
+    const auto yStart = std::max(static_cast<int>(std::ceil(p.y() - outerLimit)), clip.top());
+    const auto yEnd = std::min(static_cast<int>(std::floor(p.y() + outerLimit)), clip.bottom());
+
+    for (auto y = yStart ; y <= yEnd ; ++y)
     {
-        circlePoints(iface, p.x(), p.y(), i, j, rgb);
+        auto row = iface.getRow(y);
+        const auto dy = y - p.y();
+        const auto dy2 = dy * dy;
+        const auto xOuter = std::sqrt(std::max((outerLimit * outerLimit) - dy2, 0.0f));
+        const auto xInner = (innerLimit > 0.0f)
+                          ? std::sqrt(std::max((innerLimit * innerLimit) - dy2, 0.0f))
+                          : 0.0f;
+
+        auto plotRange = [&](float xFrom, float xTo)
+        {
+            const auto xFirst = std::max(static_cast<int>(std::ceil(xFrom)), clip.left());
+            const auto xLast = std::min(static_cast<int>(std::floor(xTo)), clip.right());
 
-        deltaE += 2;
-        if (d < 0)
+            for (auto x = xFirst ; x <= xLast ; ++x)
+            {
+                const auto distance = std::hypot(x - p.x(), dy);
+                const auto coverage = std::min(distance - inner, outer - distance) + 0.5f;
+
+                blendPixel(row[x], colour, coverageToAlpha(coverage));
+            }
+        };
+
+        if (xInner > 0.0f)
         {
-            d += deltaE;
-            deltaSE += 2;
+            plotRange(p.x() - xOuter, p.x() - xInner);
+            plotRange(p.x() + xInner, p.x() + xOuter);
         }
         else
         {
-            d += deltaSE;
-            deltaSE += 4;
-            --j;
+            plotRange(p.x() - xOuter, p.x() + xOuter);
         }
     }
 }
@@ -446,184 +1956,313 @@ circle(
 //-------------------------------------------------------------------------
 
 void
-circleFilled(
+circleFilledAntiAliased(
     Interface565Base& iface,
-    Point565 p,
-    int r,
+    PointF p,
+    float r,
     uint16_t rgb)
 {
-    int j = r;
-    int d = 1 - r;
-
-    for (int i = 0 ; i <= j ; ++i)
+    if (not inRange(p) or not inRange(r) or (r <= 0.0f))
     {
-        if (d < 0)
-        {
-            d += (2 * i) + 3;
-        }
-        else
-        {
-            circleLines(iface, p.x(), p.y(), i - 1, j, rgb);
-
-            d += (2 * (i - j)) + 5;
-            --j;
-        }
+        return;
     }
 
-    int i = j;
+    // pixels within r - 0.5 are filled, those out to r + 0.5 are blended
 
-    while (j > 0)
+    const auto innerLimit = r - 0.5f;
+    const auto outerLimit = r + 0.5f;
+
+    const auto clip = iface.getClip();
+    const RGB565 colour{rgb};
+
+    const auto yStart = std::max(static_cast<int>(std::ceil(p.y() - outerLimit)), clip.top());
+    const auto yEnd = std::min(static_cast<int>(std::floor(p.y() + outerLimit)), clip.bottom());
+
+    for (auto y = yStart ; y <= yEnd ; ++y)
     {
-        circleLines(iface, p.x(), p.y(), i, j, rgb);
+        auto row = iface.getRow(y);
+        const auto dy = y - p.y();
+        const auto dy2 = dy * dy;
+        const auto xOuter = std::sqrt(std::max((outerLimit * outerLimit) - dy2, 0.0f));
+        const auto xInner = (innerLimit > 0.0f) and ((innerLimit * innerLimit) > dy2)
+                          ? std::sqrt((innerLimit * innerLimit) - dy2)
+                          : -1.0f;
 
-        if (d < 0)
+        const auto xFirst = std::max(static_cast<int>(std::ceil(p.x() - xOuter)), clip.left());
+        const auto xLast = std::min(static_cast<int>(std::floor(p.x() + xOuter)), clip.right());
+
+        auto fillFirst = xLast + 1;
+        auto fillLast = xLast;
+
+        if (xInner >= 0.0f)
         {
-            d += (2 * (i - j)) + 5;
-            ++i;
+            fillFirst = static_cast<int>(std::ceil(p.x() - xInner));
+            fillLast = static_cast<int>(std::floor(p.x() + xInner));
+
+            if (fillFirst <= fillLast)
+            {
+                horizontalLine(iface, fillFirst, fillLast, y, rgb);
+            }
         }
-        else
+
+        for (auto x = xFirst ; x <= xLast ; ++x)
         {
-            d += 3 - (2 * j);
+            if ((x >= fillFirst) and (x <= fillLast))
+            {
+                x = fillLast;
+                continue;
+            }
+
+            const auto distance = std::hypot(x - p.x(), dy);
+            blendPixel(row[x], colour, coverageToAlpha(r + 0.5f - distance));
         }
-        --j;
     }
-
-    circleLines(iface, p.x(), p.y(), r - 1, 0, rgb);
 }
 
-//=========================================================================
+//-------------------------------------------------------------------------
 
 void
-polygon(
+polygonAntiAliased(
     Interface565Base& iface,
-    std::span<const Point565> vertices,
+    std::span<const PointF> vertices,
     uint16_t rgb)
 {
-    if (vertices.size() == 0)
-    {
-        return;
-    }
-
-    if (vertices.size() == 1)
-    {
-        iface.setPixel(vertices[0], rgb);
-        return;
-    }
+    const RGB565 colour{rgb};
 
-    for (std::size_t i = 0; i < vertices.size(); ++i)
+    for (std::size_t i = 0 ; i < vertices.size() ; ++i)
     {
         const auto& p1 = vertices[i];
         const auto& p2 = vertices[(i + 1) % vertices.size()];
 
-        line(iface, p1, p2, rgb);
+        lineWu(iface, p1, p2, colour, 1.0f);
     }
 }
 
 //-------------------------------------------------------------------------
 
 void
-polygonFilled(
+polygonFilledAntiAliased(
     Interface565Base& iface,
-    std::span<const Point565> vertices,
-    uint16_t rgb)
+    std::span<const PointF> vertices,
+    uint16_t rgb,
+    FillRule rule)
 {
-    if (vertices.size() == 0)
+    if ((vertices.size() < 3) or
+        not std::ranges::all_of(vertices, [](PointF p) { return inRange(p); }))
     {
         return;
     }
 
-    if (vertices.size() == 1)
+    // Coverage is sampled on c_subScanLines lines through each row of
+    // pixels. Along each line the coverage of a span is exact, and is
+    // accumulated as differences so the cost of a span does not depend
+    // on its length. Pixel centres are at integer coordinates, so a pixel
+    // covers x - 0.5 to x + 0.5.
+
+    constexpr int c_subScanLines{16};
+
+    struct Edge
     {
-        iface.setPixel(vertices[0], rgb);
-        return;
-    }
+        float x1;
+        float y1;
+        float y2;
+        float slope;
+        int direction;
+    };
+
+    thread_local std::vector<Edge> edges;
+    thread_local std::vector<Edge> active;
+    thread_local std::vector<std::pair<float, int>> crossings;
+    thread_local std::vector<float> deltas;
+    thread_local std::vector<uint8_t> coverage;
 
-    auto xIntersection = [](const Point565& p1,
-                            const Point565& p2,
-                            int y) -> std::optional<int>
+    edges.clear();
+    active.clear();
+
+    auto minX = vertices[0].x();
+    auto maxX = minX;
+
+    for (std::size_t i = 0 ; i < vertices.size() ; ++i)
     {
-        const auto minY = std::min(p1.y(), p2.y());
-        const auto maxY = std::max(p1.y(), p2.y());
+        auto p1 = vertices[i];
+        auto p2 = vertices[(i + 1) % vertices.size()];
 
-        if (y < minY or y >= maxY)
+        minX = std::min(minX, p1.x());
+        maxX = std::max(maxX, p1.x());
+
+        if (p1.y() == p2.y())
         {
-            return std::nullopt;
+            continue;
         }
 
-        const auto xChange = p2.x() - p1.x();
-        const auto yChange = p2.y() - p1.y();
+        const int direction = (p2.y() > p1.y()) ? 1 : -1;
 
-        return p1.x() + (y - p1.y()) * xChange / yChange;
-    };
+        if (direction < 0)
+        {
+            std::swap(p1, p2);
+        }
+
+        // an edge that is almost horizontal can have an infinite slope,
+        // which would give a NaN crossing on its first sample line
 
-    auto compareY = [](const auto& a, const auto& b) -> bool
+        const auto slope = std::clamp((p2.x() - p1.x()) / (p2.y() - p1.y()),
+                                      std::numeric_limits<float>::lowest(),
+                                      std::numeric_limits<float>::max());
+
+        edges.push_back(
+            Edge{
+                .x1 = p1.x() + 0.5f,
+                .y1 = p1.y() + 0.5f,
+                .y2 = p2.y() + 0.5f,
+                .slope = slope,
+                .direction = direction });
+    }
+
+    if (edges.empty())
     {
-        return a.y() < b.y();
-    };
+        return;
+    }
+
+    std::ranges::sort(edges, {}, &Edge::y1);
+
+    //---------------------------------------------------------------------
 
-    auto minMaxY = std::minmax_element(begin(vertices), end(vertices), compareY);
+    const auto clip = iface.getClip();
 
-    const auto minY = minMaxY.first->y();
-    const auto maxY = minMaxY.second->y();
+    const auto xStart = std::max(static_cast<int>(std::floor(minX + 0.5f)), clip.left());
+    const auto xEnd = std::min(static_cast<int>(std::ceil(maxX + 0.5f)), clip.right() + 1);
 
-    for (int y = minY; y <= maxY; ++y)
+    const auto yMax = std::ranges::max(edges, {}, &Edge::y2).y2;
+    const auto yStart = std::max(static_cast<int>(std::floor(edges.front().y1)), clip.top());
+    const auto yEnd = std::min(static_cast<int>(std::ceil(yMax)), clip.bottom() + 1);
+
+    if ((xStart >= xEnd) or (yStart >= yEnd))
+    {
+        return;
+    }
+
+    const auto width = xEnd - xStart;
+    const auto left = static_cast<float>(xStart);
+    const auto right = static_cast<float>(xEnd);
+
+    deltas.resize(width + 2);
+    coverage.resize(width);
+
+    auto addSpan = [&](float xa, float xb)
     {
-        std::vector<int> intersects;
+        xa = std::clamp(xa, left, right) - left;
+        xb = std::clamp(xb, left, right) - left;
 
-        for (auto i = 0U; i < vertices.size(); ++i)
+        if (xa >= xb)
         {
-            const auto p1 = vertices[i];
-            const auto p2 = vertices[(i + 1) % vertices.size()];
+            return;
+        }
 
-            const auto x = xIntersection(p1, p2, y);
-            if (x.has_value())
+        const auto ia = static_cast<int>(xa);
+        const auto ib = static_cast<int>(xb);
+        const auto fa = xa - ia;
+        const auto fb = xb - ib;
+
+        deltas[ia] += 1.0f - fa;
+        deltas[ia + 1] += fa;
+        deltas[ib] -= 1.0f - fb;
+        deltas[ib + 1] -= fb;
+    };
+
+    const auto& kernels = rgb565Kernels();
+    auto nextEdge = edges.begin();
+
+    for (auto y = yStart ; y < yEnd ; ++y)
+    {
+        const auto yTop = static_cast<float>(y);
+        const auto yBottom = yTop + 1.0f;
+
+        std::erase_if(active, [yTop](const auto& edge) { return edge.y2 <= yTop; });
+
+        for ( ; (nextEdge != edges.end()) and (nextEdge->y1 < yBottom) ; ++nextEdge)
+        {
+            if (nextEdge->y2 > yTop)
             {
-                intersects.push_back(x.value());
+                active.push_back(*nextEdge);
             }
         }
 
-        std::ranges::sort(intersects);
+        std::ranges::fill(deltas, 0.0f);
 
-        const auto id = iface.getDimensions();
-
-        for (std::size_t i = 0; i + 1 < intersects.size(); i += 2)
+        for (int s = 0 ; s < c_subScanLines ; ++s)
         {
-            const auto x1 = intersects[i];
-            const auto x2 = intersects[i + 1];
+            const auto sy = yTop + ((s + 0.5f) / c_subScanLines);
+
+            crossings.clear();
+
+            for (const auto& edge : active)
+            {
+                if ((edge.y1 <= sy) and (sy < edge.y2))
+                {
+                    crossings.emplace_back(edge.x1 + ((sy - edge.y1) * edge.slope),
+                                           edge.direction);
+                }
+            }
+
+            std::ranges::sort(crossings);
 
-            if (x2 >= 0 and x1 < id.width())
+            if (rule == FillRule::EVEN_ODD)
+            {
+                for (std::size_t i = 0 ; (i + 1) < crossings.size() ; i += 2)
+                {
+                    addSpan(crossings[i].first, crossings[i + 1].first);
+                }
+            }
+            else
             {
-                horizontalLine(iface, x1, x2, y, rgb);
+                int winding{0};
+                float xa{0.0f};
+
+                for (const auto& [x, direction] : crossings)
+                {
+                    if (winding == 0)
+                    {
+                        xa = x;
+                    }
+
+                    winding += direction;
+
+                    if (winding == 0)
+                    {
+                        addSpan(xa, x);
+                    }
+                }
             }
         }
-    }
-}
 
-//-------------------------------------------------------------------------
+        //-----------------------------------------------------------------
 
-void
-polyline(
-    Interface565Base& iface,
-    std::span<const Point565> vertices,
-    uint16_t rgb)
-{
-    if (vertices.size() == 0)
-    {
-        return;
-    }
+        float sum{0.0f};
+        int first{width};
+        int last{-1};
 
-    if (vertices.size() == 1)
-    {
-        iface.setPixel(vertices[0], rgb);
-        return;
-    }
+        for (auto i = 0 ; i < width ; ++i)
+        {
+            sum += deltas[i];
+            const auto alpha = coverageToAlpha(sum / c_subScanLines);
 
-    for (std::size_t i = 0; i < vertices.size() - 1; ++i)
-    {
-        const auto& p1 = vertices[i];
-        const auto& p2 = vertices[i + 1];
+            coverage[i] = static_cast<uint8_t>(alpha);
 
-        line(iface, p1, p2, rgb);
+            if (alpha)
+            {
+                first = std::min(first, i);
+                last = i;
+            }
+        }
+
+        if (first <= last)
+        {
+            const auto length = last - first + 1;
+
+            kernels.blendCoverage(rgb,
+                                  std::span(coverage).subspan(first, length),
+                                  iface.getRow(y).subspan(xStart + first, length));
+        }
     }
 }
 
@@ -33,6 +33,7 @@
 #include <span>
 
 #include "image565.h"
+#include "paint565.h"
 #include "point.h"
 #include "rgb565.h"
 
@@ -43,6 +44,9 @@ namespace fb16
 
 //-------------------------------------------------------------------------
 
+// Everything drawn is clipped to the current clip rectangle of the
+// interface, see Interface565Base::pushClip().
+
 void
 box(
     Interface565Base& iface,
@@ -98,6 +102,13 @@ boxFilled(
     boxFilled(iface, p1, p2, RGB565{rgb}, alpha);
 }
 
+void
+boxFilled(
+    Interface565Base& iface,
+    Point565 p1,
+    Point565 p2,
+    const Paint565& paint);
+
 //-------------------------------------------------------------------------
 
 void
@@ -197,6 +208,13 @@ circleFilled(
     circleFilled(iface, p, r, rgb.get565());
 }
 
+void
+circleFilled(
+    Interface565Base& iface,
+    Point565 p,
+    int r,
+    const Paint565& paint);
+
 //-------------------------------------------------------------------------
 
 void
@@ -216,21 +234,40 @@ polygon(
 
 //-------------------------------------------------------------------------
 
+// Which parts of a self intersecting polygon are inside. EVEN_ODD fills
+// where a scan line has crossed an odd number of edges, NON_ZERO where
+// the edges crossed do not cancel out by direction.
+
+enum class FillRule
+{
+    EVEN_ODD,
+    NON_ZERO
+};
+
 void
 polygonFilled(
     Interface565Base& iface,
     std::span<const Point565> vertices,
-    uint16_t rgb);
+    uint16_t rgb,
+    FillRule rule = FillRule::EVEN_ODD);
 
 inline void
 polygonFilled(
     Interface565Base& iface,
     std::span<const Point565> vertices,
-    const RGB565& rgb)
+    const RGB565& rgb,
+    FillRule rule = FillRule::EVEN_ODD)
 {
-    polygonFilled(iface, vertices, rgb.get565());
+    polygonFilled(iface, vertices, rgb.get565(), rule);
 }
 
+void
+polygonFilled(
+    Interface565Base& iface,
+    std::span<const Point565> vertices,
+    const Paint565& paint,
+    FillRule rule = FillRule::EVEN_ODD);
+
 //-------------------------------------------------------------------------
 
 void
@@ -248,6 +285,305 @@ polyline(
     polyline(iface, vertices, rgb.get565());
 }
 
+//=========================================================================
+// Thick strokes and rounded shapes. These are filled a scanline span at a
+// time, a pixel being drawn when its centre falls inside the shape.
+
+// How the open ends of a thick line or polyline are drawn.
+
+enum class LineCap
+{
+    BUTT,
+    SQUARE,
+    ROUND
+};
+
+// How segments of a thick polyline meet. A miter that would extend more
+// than four half widths from the vertex falls back to a bevel.
+
+enum class LineJoin
+{
+    MITER,
+    BEVEL,
+    ROUND
+};
+
+//-------------------------------------------------------------------------
+
+void
+lineThick(
+    Interface565Base& iface,
+    Point565 p1,
+    Point565 p2,
+    int width,
+    uint16_t rgb,
+    LineCap cap = LineCap::BUTT);
+
+inline void
+lineThick(
+    Interface565Base& iface,
+    Point565 p1,
+    Point565 p2,
+    int width,
+    const RGB565& rgb,
+    LineCap cap = LineCap::BUTT)
+{
+    lineThick(iface, p1, p2, width, rgb.get565(), cap);
+}
+
+//-------------------------------------------------------------------------
+
+void
+polylineThick(
+    Interface565Base& iface,
+    std::span<const Point565> vertices,
+    int width,
+    uint16_t rgb,
+    LineJoin join = LineJoin::ROUND,
+    LineCap cap = LineCap::BUTT);
+
+inline void
+polylineThick(
+    Interface565Base& iface,
+    std::span<const Point565> vertices,
+    int width,
+    const RGB565& rgb,
+    LineJoin join = LineJoin::ROUND,
+    LineCap cap = LineCap::BUTT)
+{
+    polylineThick(iface, vertices, width, rgb.get565(), join, cap);
+}
+
+//-------------------------------------------------------------------------
+
+// A ring centred on radius r.
+
+void
+circleThick(
+    Interface565Base& iface,
+    Point565 p,
+    int r,
+    int width,
+    uint16_t rgb);
+
+inline void
+circleThick(
+    Interface565Base& iface,
+    Point565 p,
+    int r,
+    int width,
+    const RGB565& rgb)
+{
+    circleThick(iface, p, r, width, rgb.get565());
+}
+
+//-------------------------------------------------------------------------
+
+// Angles are in degrees, clockwise from three o'clock (y increases down
+// the screen). The arc runs clockwise from startAngle to endAngle, so
+// arc(..., 135, 405, ...) is the 270 degree sweep of a typical gauge.
+
+void
+arc(
+    Interface565Base& iface,
+    Point565 p,
+    int r,
+    float startAngle,
+    float endAngle,
+    int width,
+    uint16_t rgb);
+
+inline void
+arc(
+    Interface565Base& iface,
+    Point565 p,
+    int r,
+    float startAngle,
+    float endAngle,
+    int width,
+    const RGB565& rgb)
+{
+    arc(iface, p, r, startAngle, endAngle, width, rgb.get565());
+}
+
+//-------------------------------------------------------------------------
+
+// A pie slice, with angles as for arc().
+
+void
+arcFilled(
+    Interface565Base& iface,
+    Point565 p,
+    int r,
+    float startAngle,
+    float endAngle,
+    uint16_t rgb);
+
+inline void
+arcFilled(
+    Interface565Base& iface,
+    Point565 p,
+    int r,
+    float startAngle,
+    float endAngle,
+    const RGB565& rgb)
+{
+    arcFilled(iface, p, r, startAngle, endAngle, rgb.get565());
+}
+
+//-------------------------------------------------------------------------
+
+// The corner radius is limited to half the shorter side. The outline is
+// width pixels wide, drawn inside the box.
+
+void
+boxRounded(
+    Interface565Base& iface,
+    Point565 p1,
+    Point565 p2,
+    int radius,
+    int width,
+    uint16_t rgb);
+
+inline void
+boxRounded(
+    Interface565Base& iface,
+    Point565 p1,
+    Point565 p2,
+    int radius,
+    int width,
+    const RGB565& rgb)
+{
+    boxRounded(iface, p1, p2, radius, width, rgb.get565());
+}
+
+//-------------------------------------------------------------------------
+
+void
+boxRoundedFilled(
+    Interface565Base& iface,
+    Point565 p1,
+    Point565 p2,
+    int radius,
+    uint16_t rgb);
+
+inline void
+boxRoundedFilled(
+    Interface565Base& iface,
+    Point565 p1,
+    Point565 p2,
+    int radius,
+    const RGB565& rgb)
+{
+    boxRoundedFilled(iface, p1, p2, radius, rgb.get565());
+}
+
+//=========================================================================
+// Anti-aliased drawing. Coordinates are in pixels, with the centre of
+// each pixel at integer values, so shapes can be placed to sub-pixel
+// accuracy. Edge pixels are blended with what is already there. Nothing
+// is drawn for coordinates or sizes that are not finite, or are beyond
+// +/-2^24 pixels.
+
+using PointF = Point<float>;
+
+//-------------------------------------------------------------------------
+
+void
+lineAntiAliased(
+    Interface565Base& iface,
+    PointF p1,
+    PointF p2,
+    uint16_t rgb,
+    float width = 1.0f);
+
+inline void
+lineAntiAliased(
+    Interface565Base& iface,
+    PointF p1,
+    PointF p2,
+    const RGB565& rgb,
+    float width = 1.0f)
+{
+    lineAntiAliased(iface, p1, p2, rgb.get565(), width);
+}
+
+//-------------------------------------------------------------------------
+
+void
+circleAntiAliased(
+    Interface565Base& iface,
+    PointF p,
+    float r,
+    uint16_t rgb,
+    float width = 1.0f);
+
+inline void
+circleAntiAliased(
+    Interface565Base& iface,
+    PointF p,
+    float r,
+    const RGB565& rgb,
+    float width = 1.0f)
+{
+    circleAntiAliased(iface, p, r, rgb.get565(), width);
+}
+
+//-------------------------------------------------------------------------
+
+void
+circleFilledAntiAliased(
+    Interface565Base& iface,
+    PointF p,
+    float r,
+    uint16_t rgb);
+
+inline void
+circleFilledAntiAliased(
+    Interface565Base& iface,
+    PointF p,
+    float r,
+    const RGB565& rgb)
+{
+    circleFilledAntiAliased(iface, p, r, rgb.get565());
+}
+
+//-------------------------------------------------------------------------
+
+void
+polygonAntiAliased(
+    Interface565Base& iface,
+    std::span<const PointF> vertices,
+    uint16_t rgb);
+
+inline void
+polygonAntiAliased(
+    Interface565Base& iface,
+    std::span<const PointF> vertices,
+    const RGB565& rgb)
+{
+    polygonAntiAliased(iface, vertices, rgb.get565());
+}
+
+//-------------------------------------------------------------------------
+
+void
+polygonFilledAntiAliased(
+    Interface565Base& iface,
+    std::span<const PointF> vertices,
+    uint16_t rgb,
+    FillRule rule = FillRule::EVEN_ODD);
+
+inline void
+polygonFilledAntiAliased(
+    Interface565Base& iface,
+    std::span<const PointF> vertices,
+    const RGB565& rgb,
+    FillRule rule = FillRule::EVEN_ODD)
+{
+    polygonFilledAntiAliased(iface, vertices, rgb.get565(), rule);
+}
+
 //-------------------------------------------------------------------------
 
 } // namespace fb16
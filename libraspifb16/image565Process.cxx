@@ -26,13 +26,24 @@
 //-------------------------------------------------------------------------
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
 #include <functional>
 #include <numbers>
+#include <span>
 #include <stdexcept>
+#include <vector>
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 #include "image565.h"
 #include "image565Process.h"
+#include "rgb565Kernels.h"
 
 //-------------------------------------------------------------------------
 
@@ -81,9 +92,37 @@ private:
 
 //-------------------------------------------------------------------------
 
+enum ScratchImage
+{
+    SCRATCH_IMAGE_A,
+    SCRATCH_IMAGE_B,
+    SCRATCH_IMAGE_COUNT
+};
+
+//-------------------------------------------------------------------------
+
+// Intermediate images used by the ...To() functions. They are kept per
+// thread and only grow, so repeated calls with the same sized input do
+// not allocate.
+
+fb16::Image565&
+scratchImage(
+    ScratchImage index,
+    fb16::Dimensions565 d)
+{
+    thread_local std::array<fb16::Image565, SCRATCH_IMAGE_COUNT> scratch;
+
+    auto& image = scratch[index];
+    image.setDimensions(d);
+
+    return image;
+}
+
+//-------------------------------------------------------------------------
+
 void
 rowsRotate(
-    const fb16::Image565& image,
+    const fb16::Interface565Base& image,
     fb16::Image565& output,
     double sinAngle,
     double cosAngle,
@@ -152,25 +191,322 @@ rowsRotate(
 
 //-------------------------------------------------------------------------
 
+// Quarter turns are blocked transposes. The image is walked in square
+// blocks small enough that a block of input and of output both stay in
+// the L1 cache, and each block is transposed as 8x8 tiles of pixels,
+// held in registers where SIMD is available.
+
+constexpr int c_rotateTileSize{8};
+constexpr int c_rotateBlockSize{64};
+
+//-------------------------------------------------------------------------
+
+// output[k * outputStride + m] = input[m * inputStride + k]. Strides are
+// in pixels and may be negative.
+
+inline void
+transposeTile(
+    const uint16_t* input,
+    std::ptrdiff_t inputStride,
+    uint16_t* output,
+    std::ptrdiff_t outputStride) noexcept
+{
+#if defined(__ARM_NEON)
+
+    auto row = [&](int m) { return vld1q_u16(input + (m * inputStride)); };
+
+    const auto t0 = vtrnq_u16(row(0), row(1));
+    const auto t1 = vtrnq_u16(row(2), row(3));
+    const auto t2 = vtrnq_u16(row(4), row(5));
+    const auto t3 = vtrnq_u16(row(6), row(7));
+
+    const auto u0 = vtrnq_u32(vreinterpretq_u32_u16(t0.val[0]),
+                              vreinterpretq_u32_u16(t1.val[0]));
+    const auto u1 = vtrnq_u32(vreinterpretq_u32_u16(t0.val[1]),
+                              vreinterpretq_u32_u16(t1.val[1]));
+    const auto u2 = vtrnq_u32(vreinterpretq_u32_u16(t2.val[0]),
+                              vreinterpretq_u32_u16(t3.val[0]));
+    const auto u3 = vtrnq_u32(vreinterpretq_u32_u16(t2.val[1]),
+                              vreinterpretq_u32_u16(t3.val[1]));
+
+    auto store = [&](int k, uint32x4_t a, uint32x4_t b, bool high)
+    {
+        const auto a16 = vreinterpretq_u16_u32(a);
+        const auto b16 = vreinterpretq_u16_u32(b);
+
+        const auto value = (high)
+                         ? vcombine_u16(vget_high_u16(a16), vget_high_u16(b16))
+                         : vcombine_u16(vget_low_u16(a16), vget_low_u16(b16));
+
+        vst1q_u16(output + (k * outputStride), value);
+    };
+
+    store(0, u0.val[0], u2.val[0], false);
+    store(1, u1.val[0], u3.val[0], false);
+    store(2, u0.val[1], u2.val[1], false);
+    store(3, u1.val[1], u3.val[1], false);
+    store(4, u0.val[0], u2.val[0], true);
+    store(5, u1.val[0], u3.val[0], true);
+    store(6, u0.val[1], u2.val[1], true);
+    store(7, u1.val[1], u3.val[1], true);
+
+#elif defined(__SSE2__)
+
+    auto row = [&](int m)
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + (m * inputStride)));
+    };
+
+    const auto r0 = row(0);
+    const auto r1 = row(1);
+    const auto r2 = row(2);
+    const auto r3 = row(3);
+    const auto r4 = row(4);
+    const auto r5 = row(5);
+    const auto r6 = row(6);
+    const auto r7 = row(7);
+
+    const auto a0 = _mm_unpacklo_epi16(r0, r1);
+    const auto a1 = _mm_unpackhi_epi16(r0, r1);
+    const auto a2 = _mm_unpacklo_epi16(r2, r3);
+    const auto a3 = _mm_unpackhi_epi16(r2, r3);
+    const auto a4 = _mm_unpacklo_epi16(r4, r5);
+    const auto a5 = _mm_unpackhi_epi16(r4, r5);
+    const auto a6 = _mm_unpacklo_epi16(r6, r7);
+    const auto a7 = _mm_unpackhi_epi16(r6, r7);
+
+    const auto b0 = _mm_unpacklo_epi32(a0, a2);
+    const auto b1 = _mm_unpackhi_epi32(a0, a2);
+    const auto b2 = _mm_unpacklo_epi32(a1, a3);
+    const auto b3 = _mm_unpackhi_epi32(a1, a3);
+    const auto b4 = _mm_unpacklo_epi32(a4, a6);
+    const auto b5 = _mm_unpackhi_epi32(a4, a6);
+    const auto b6 = _mm_unpacklo_epi32(a5, a7);
+    const auto b7 = _mm_unpackhi_epi32(a5, a7);
+
+    auto store = [&](int k, __m128i value)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + (k * outputStride)), value);
+    };
+
+    store(0, _mm_unpacklo_epi64(b0, b4));
+    store(1, _mm_unpackhi_epi64(b0, b4));
+    store(2, _mm_unpacklo_epi64(b1, b5));
+    store(3, _mm_unpackhi_epi64(b1, b5));
+    store(4, _mm_unpacklo_epi64(b2, b6));
+    store(5, _mm_unpackhi_epi64(b2, b6));
+    store(6, _mm_unpacklo_epi64(b3, b7));
+    store(7, _mm_unpackhi_epi64(b3, b7));
+
+#else
+
+    for (int k = 0 ; k < c_rotateTileSize ; ++k)
+    {
+        for (int m = 0 ; m < c_rotateTileSize ; ++m)
+        {
+            output[(k * outputStride) + m] = input[(m * inputStride) + k];
+        }
+    }
+
+#endif
+}
+
+//-------------------------------------------------------------------------
+
+// Rotate the area of input a quarter turn, clockwise (rotate90) or
+// anti-clockwise (rotate270), to where it lands in output. The output
+// must already have the transposed dimensions.
+
+void
+rotateQuarter(
+    const fb16::Interface565Base& input,
+    fb16::Interface565Base& output,
+    bool clockwise,
+    const fb16::Rectangle565& area)
+{
+    const auto id = input.getDimensions();
+
+    const std::ptrdiff_t inputStride = input.getLineLengthPixels();
+    const std::ptrdiff_t outputStride = output.getLineLengthPixels();
+
+    const auto* inputBuffer = input.getBuffer().data();
+    auto* outputBuffer = output.getBuffer().data();
+
+    auto outputPoint = [&](int i, int j) -> Point
+    {
+        return (clockwise)
+             ? Point{id.height() - j - 1, i}
+             : Point{j, id.width() - i - 1};
+    };
+
+    auto edge = [&](int iStart, int iEnd, int jStart, int jEnd)
+    {
+        for (auto j = jStart ; j < jEnd ; ++j)
+        {
+            for (auto i = iStart ; i < iEnd ; ++i)
+            {
+                *(outputBuffer + output.offset(outputPoint(i, j))) =
+                    *(inputBuffer + input.offset(Point{i, j}));
+            }
+        }
+    };
+
+    constexpr auto tile = c_rotateTileSize;
+
+    const auto iAreaEnd = area.left() + area.width();
+    const auto jAreaEnd = area.top() + area.height();
+
+    for (auto jBlock = area.top() ; jBlock < jAreaEnd ; jBlock += c_rotateBlockSize)
+    {
+        const auto jBlockEnd = std::min(jBlock + c_rotateBlockSize, jAreaEnd);
+
+        for (auto iBlock = area.left() ; iBlock < iAreaEnd ; iBlock += c_rotateBlockSize)
+        {
+            const auto iBlockEnd = std::min(iBlock + c_rotateBlockSize, iAreaEnd);
+
+            for (auto j = jBlock ; j < jBlockEnd ; j += tile)
+            {
+                for (auto i = iBlock ; i < iBlockEnd ; i += tile)
+                {
+                    if (((i + tile) > iBlockEnd) or ((j + tile) > jBlockEnd))
+                    {
+                        edge(i,
+                             std::min(i + tile, iBlockEnd),
+                             j,
+                             std::min(j + tile, jBlockEnd));
+                    }
+                    else if (clockwise)
+                    {
+                        // read the tile bottom row first, so that each
+                        // transposed row runs left to right in the output
+
+                        transposeTile(
+                            inputBuffer + input.offset(Point{i, j + tile - 1}),
+                            -inputStride,
+                            outputBuffer + output.offset(outputPoint(i, j + tile - 1)),
+                            outputStride);
+                    }
+                    else
+                    {
+                        // write the tile bottom row first, as output rows
+                        // run upwards as i increases
+
+                        transposeTile(
+                            inputBuffer + input.offset(Point{i, j}),
+                            inputStride,
+                            outputBuffer + output.offset(outputPoint(i, j)),
+                            -outputStride);
+                    }
+                }
+            }
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+rotateQuarter(
+    const fb16::Interface565Base& input,
+    fb16::Interface565Base& output,
+    bool clockwise)
+{
+    const fb16::Rectangle565 all{fb16::Point565{0, 0}, input.getDimensions()};
+    rotateQuarter(input, output, clockwise, all);
+}
+
+//-------------------------------------------------------------------------
+
 void
 rowsToGrey(
     const fb16::Interface565Base& input,
-    fb16::Image565& output,
+    fb16::Interface565Base& output,
     int jStart,
     int jEnd)
 {
-    const auto id = input.getDimensions();
-    auto inputi = input.getBuffer().data() + (jStart * id.width());
+    const auto& kernels = fb16::rgb565Kernels();
 
     for (auto j = jStart ; j < jEnd ; ++j)
     {
-        for (int i = 0 ; i < id.width() ; ++i)
+        kernels.grey(input.getRow(j), output.getRow(j));
+    }
+}
+
+//-------------------------------------------------------------------------
+
+// Repeat each of count input pixels scale times. Scales of 2 and 4 use a
+// widening (interleaving) store where SIMD is available.
+
+void
+expandRow(
+    const uint16_t* input,
+    int count,
+    uint16_t* output,
+    int scale) noexcept
+{
+    int i = 0;
+
+#if defined(__ARM_NEON)
+
+    if (scale == 2)
+    {
+        for ( ; (i + 8) <= count ; i += 8)
+        {
+            const auto v = vld1q_u16(input + i);
+            vst2q_u16(output + (i * 2), (uint16x8x2_t{{v, v}}));
+        }
+    }
+    else if (scale == 4)
+    {
+        for ( ; (i + 8) <= count ; i += 8)
         {
-            auto pixel = *(inputi++);
-            Point p{i, j};
-            output.setPixel(p,fb16::RGB565(pixel).toGrey().get565());
+            const auto v = vld1q_u16(input + i);
+            vst4q_u16(output + (i * 4), (uint16x8x4_t{{v, v, v, v}}));
         }
     }
+
+#elif defined(__SSE2__)
+
+    auto store = [](uint16_t* o, __m128i value)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(o), value);
+    };
+
+    if (scale == 2)
+    {
+        for ( ; (i + 8) <= count ; i += 8)
+        {
+            const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+            auto* o = output + (i * 2);
+
+            store(o, _mm_unpacklo_epi16(v, v));
+            store(o + 8, _mm_unpackhi_epi16(v, v));
+        }
+    }
+    else if (scale == 4)
+    {
+        for ( ; (i + 8) <= count ; i += 8)
+        {
+            const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+            const auto lo = _mm_unpacklo_epi16(v, v);
+            const auto hi = _mm_unpackhi_epi16(v, v);
+            auto* o = output + (i * 4);
+
+            store(o, _mm_unpacklo_epi32(lo, lo));
+            store(o + 8, _mm_unpackhi_epi32(lo, lo));
+            store(o + 16, _mm_unpacklo_epi32(hi, hi));
+            store(o + 24, _mm_unpackhi_epi32(hi, hi));
+        }
+    }
+
+#endif
+
+    output += i * scale;
+
+    for ( ; i < count ; ++i)
+    {
+        output = std::fill_n(output, scale, input[i]);
+    }
 }
 
 //-------------------------------------------------------------------------
@@ -265,27 +601,10 @@ boxBlurColumns(
 
 //-------------------------------------------------------------------------
 
-fb16::Image565
-fb16::boxBlur(
-    const fb16::Interface565Base& input,
-    int radius)
-{
-    const auto d = input.getDimensions();
-
-    fb16::Image565 rb{d};
-    fb16::Image565 output{d};
-
-    boxBlurRows(input, rb, radius, 0, d.height());
-    boxBlurColumns(rb, output, radius, 0, d.width());
-
-    return output;
-}
-
-//-------------------------------------------------------------------------
-
-fb16::Image565
-fb16::enlighten(
+void
+rowsEnlighten(
     const fb16::Interface565Base& input,
+    fb16::Interface565Base& output,
     double strength)
 {
     auto flerp = [](double value1, double value2, double alpha)->double
@@ -298,36 +617,208 @@ fb16::enlighten(
         return static_cast<uint8_t>(std::clamp(channel * scale, 0.0, 255.0));
     };
 
-    const auto mb = fb16::boxBlur(fb16::maxRGB(input), 12);
+    const auto d = input.getDimensions();
+
+    auto& mb = scratchImage(SCRATCH_IMAGE_A, d);
+    fb16::maxRGBTo(input, mb);
 
-    fb16::Image565 output{input.getDimensions()};
+    auto& rb = scratchImage(SCRATCH_IMAGE_B, d);
+    boxBlurRows(mb, rb, 12, 0, d.height());
+    boxBlurColumns(rb, mb, 12, 0, d.width());
 
     const auto strength2 = strength * strength;
     const auto minI = 1.0 / flerp(1.0, 10.0, strength2);
     const auto maxI = 1.0 / flerp(1.0, 1.111, strength2);
 
-    auto mbi = mb.getBuffer().data();
-    auto outputi = output.getBuffer().data();
+    //---------------------------------------------------------------------
+    // The scale applied to a pixel depends only on the 8 bit level of the
+    // blurred maximum, so there are at most 256 of them. Each is converted
+    // to 16.16 fixed point for the scale kernel, but only if that gives
+    // exactly the same result as the double scale for every 565 channel
+    // value. Rows that need a level without an exact fixed point scale
+    // fall back to the double calculation.
+
+    auto exactFor = [&scaled](uint32_t fixed, double scale) -> bool
+    {
+        auto channel = [&](uint8_t value, int bits) -> bool
+        {
+            const auto fixedValue = std::min((value * fixed) >> 16, 255U);
+            const uint32_t doubleValue = scaled(value, scale);
+
+            return (fixedValue >> bits) == (doubleValue >> bits);
+        };
+
+        for (uint8_t v = 0 ; v < 64 ; ++v)
+        {
+            if (not channel((v << 2) | (v >> 4), 2))
+            {
+                return false;
+            }
+
+            if ((v < 32) and not channel((v << 3) | (v >> 2), 3))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    };
 
-    for (auto pixel : input.getBuffer())
+    constexpr int levels{256};
+    constexpr auto maxFixed = static_cast<long>(levels) << 16;
+
+    std::array<double, levels> scales{};
+    std::array<uint32_t, levels> fixedScales{};
+    std::array<bool, levels> exact{};
+
+    for (auto level = 0 ; level < levels ; ++level)
     {
-        fb16::RGB565 c{pixel};
-        const auto rgb8 = c.getRGB8();
-        const auto max = fb16::RGB8(*(mbi++)).red;
-        const auto illumination = std::clamp(max / 255.0, minI, maxI);
+        const auto illumination = std::clamp(level / 255.0, minI, maxI);
+        auto& scale = scales[level];
 
         if (illumination < maxI)
         {
             const auto r = illumination / maxI;
-            const auto scale = (0.4 + (r * 0.6)) / r;
+            scale = (0.4 + (r * 0.6)) / r;
+        }
+        else
+        {
+            scale = 1.0;
+        }
+
+        const auto nearest = std::lround(scale * 65536.0);
 
-            c.setRGB(scaled(rgb8.red, scale),
-                     scaled(rgb8.green, scale),
-                     scaled(rgb8.blue, scale));
+        for (const auto delta : { 0, -1, 1, -2, 2 })
+        {
+            const auto fixed = nearest + delta;
+
+            if ((fixed >= 0) and
+                (fixed < maxFixed) and
+                exactFor(static_cast<uint32_t>(fixed), scale))
+            {
+                fixedScales[level] = static_cast<uint32_t>(fixed);
+                exact[level] = true;
+                break;
+            }
+        }
+    }
+
+    //---------------------------------------------------------------------
+
+    // the scales of a row, kept per thread and only grown, as the scratch
+    // images are, so enlightening frames of the same size does not allocate
+
+    thread_local std::vector<uint32_t> scaleBuffer;
+    const auto width = static_cast<std::size_t>(d.width());
+
+    if (scaleBuffer.size() < width)
+    {
+        scaleBuffer.resize(width);
+    }
+
+    const auto& kernels = fb16::rgb565Kernels();
+    const auto rowScales = std::span{scaleBuffer}.first(width);
+
+    for (auto j = 0 ; j < d.height() ; ++j)
+    {
+        const auto inputRow = input.getRow(j);
+        const auto outputRow = output.getRow(j);
+        const auto mbRow = mb.getRow(j);
+
+        bool rowExact{true};
+
+        for (auto i = 0 ; i < d.width() ; ++i)
+        {
+            const auto level = fb16::RGB8(mbRow[i]).red;
+
+            rowScales[i] = fixedScales[level];
+            rowExact = rowExact and exact[level];
         }
 
-        *(outputi++) = c.get565();
+        if (rowExact)
+        {
+            kernels.scale(inputRow, rowScales, outputRow);
+            continue;
+        }
+
+        for (auto i = 0 ; i < d.width() ; ++i)
+        {
+            const auto rgb8 = fb16::RGB8(inputRow[i]);
+            const auto scale = scales[fb16::RGB8(mbRow[i]).red];
+
+            outputRow[i] = fb16::RGB565::rgbTo565(scaled(rgb8.red, scale),
+                                                  scaled(rgb8.green, scale),
+                                                  scaled(rgb8.blue, scale));
+        }
     }
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Image565
+fb16::boxBlur(
+    const fb16::Interface565Base& input,
+    int radius)
+{
+    fb16::Image565 output;
+    boxBlurTo(input, output, radius);
+
+    return output;
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Image565&
+fb16::boxBlurTo(
+    const fb16::Interface565Base& input,
+    fb16::Image565& output,
+    int radius)
+{
+    const auto d = input.getDimensions();
+    auto& rb = scratchImage(SCRATCH_IMAGE_B, d);
+
+    boxBlurRows(input, rb, radius, 0, d.height());
+    output.setDimensions(d);
+    boxBlurColumns(rb, output, radius, 0, d.width());
+
+    return output;
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Image565
+fb16::enlighten(
+    const fb16::Interface565Base& input,
+    double strength)
+{
+    fb16::Image565 output;
+    enlightenTo(input, output, strength);
+
+    return output;
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Interface565Base&
+fb16::enlightenInPlace(
+    fb16::Interface565Base& image,
+    double strength)
+{
+    rowsEnlighten(image, image, strength);
+
+    return image;
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Image565&
+fb16::enlightenTo(
+    const fb16::Interface565Base& input,
+    fb16::Image565& output,
+    double strength)
+{
+    output.setDimensions(input.getDimensions());
+    rowsEnlighten(input, output, strength);
 
     return output;
 }
@@ -338,14 +829,108 @@ fb16::Image565
 fb16::maxRGB(
     const fb16::Interface565Base& input)
 {
-    fb16::Image565 output{input.getDimensions()};
-    auto* buffer = output.getBuffer().data();
+    fb16::Image565 output;
+    maxRGBTo(input, output);
 
-    for (const auto pixel : input.getBuffer())
+    return output;
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Image565&
+fb16::maxRGBTo(
+    const fb16::Interface565Base& input,
+    fb16::Image565& output)
+{
+    const auto d = input.getDimensions();
+    output.setDimensions(d);
+
+    const auto& kernels = fb16::rgb565Kernels();
+
+    for (auto j = 0 ; j < d.height() ; ++j)
     {
-       fb16::RGB8 rgb8(pixel);
-       const auto grey(std::max({rgb8.red, rgb8.green, rgb8.blue}));
-       *(buffer++) = fb16::RGB565::rgbTo565(grey, grey, grey);
+        kernels.maxChannel(input.getRow(j), output.getRow(j));
+    }
+
+    return output;
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Interface565Base&
+fb16::orientTo(
+    const fb16::Interface565Base& input,
+    fb16::Interface565Base& output,
+    fb16::Orientation565 orientation)
+{
+    const Rectangle565 all{Point565{0, 0}, input.getDimensions()};
+
+    return orientTo(input, output, orientation, all);
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Interface565Base&
+fb16::orientTo(
+    const fb16::Interface565Base& input,
+    fb16::Interface565Base& output,
+    fb16::Orientation565 orientation,
+    const fb16::Rectangle565& area)
+{
+    const auto id = input.getDimensions();
+    const auto od = output.getDimensions();
+
+    const bool transpose = (orientation == Orientation565::ROTATE_90) or
+                           (orientation == Orientation565::ROTATE_270);
+
+    const auto expected = (transpose)
+                        ? Dimensions565{id.height(), id.width()}
+                        : id;
+
+    if (od != expected)
+    {
+        throw std::invalid_argument("orientTo output dimensions do not match input");
+    }
+
+    const auto a = Rectangle565{Point565{0, 0}, id}.intersection(area);
+
+    if (a.empty())
+    {
+        return output;
+    }
+
+    switch (orientation)
+    {
+    case Orientation565::ROTATE_0:
+
+        for (auto j = a.top() ; j <= a.bottom() ; ++j)
+        {
+            std::ranges::copy(input.getRow(j).subspan(a.left(), a.width()),
+                              output.getRow(j).begin() + a.left());
+        }
+
+        break;
+
+    case Orientation565::ROTATE_90:
+
+        rotateQuarter(input, output, true, a);
+        break;
+
+    case Orientation565::ROTATE_180:
+
+        for (auto j = a.top() ; j <= a.bottom() ; ++j)
+        {
+            std::ranges::reverse_copy(input.getRow(j).subspan(a.left(), a.width()),
+                                      output.getRow(id.height() - j - 1).begin() +
+                                      (id.width() - a.right() - 1));
+        }
+
+        break;
+
+    case Orientation565::ROTATE_270:
+
+        rotateQuarter(input, output, false, a);
+        break;
     }
 
     return output;
@@ -627,6 +1212,21 @@ fb16::rotate(
     const fb16::Interface565Base& input,
     uint32_t background,
     double angle)
+{
+    Image565 output;
+    rotateTo(input, output, background, angle);
+
+    return output;
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Image565&
+fb16::rotateTo(
+    const fb16::Interface565Base& input,
+    fb16::Image565& output,
+    uint32_t background,
+    double angle)
 {
     if (angle >= 360.0)
     {
@@ -639,32 +1239,31 @@ fb16::rotate(
 
     // rotate so angle is in the range 0 to 90
 
-    Image565 image;
+    const Interface565Base* image{&input};
+    const auto d = input.getDimensions();
+    const Dimensions565 dt{d.height(), d.width()};
 
     if (angle >= 270.0)
     {
-        image = rotate270(input);
+        image = &rotate270To(input, scratchImage(SCRATCH_IMAGE_A, dt));
         angle -= 270.0;
     }
     else if (angle >= 180.0)
     {
-        image = rotate180(input);
+        image = &rotate180To(input, scratchImage(SCRATCH_IMAGE_A, d));
         angle -= 180.0;
     }
     else if (angle >= 90.0)
     {
-        image = rotate90(input);
+        image = &rotate90To(input, scratchImage(SCRATCH_IMAGE_A, dt));
         angle -= 90.0;
     }
-    else
-    {
-        image = input;
-    }
 
     // now angle is in the range 0 to 90
     if (std::min(angle, 90.0 - angle) < 0.01)
     {
-        return image;
+        output = *image;
+        return output;
     }
 
     //---------------------------------------------------------------------
@@ -687,7 +1286,7 @@ fb16::rotate(
     const auto cosAngle = std::cos(radians);
     const auto sinAngle = std::sin(radians);
 
-    const auto id = image.getDimensions();
+    const auto id = image->getDimensions();
 
     const auto x10 = (id.width() * cosAngle) + (id.height() * sinAngle);
     const auto y00 = id.height() * cosAngle;
@@ -699,10 +1298,10 @@ fb16::rotate(
         static_cast<int>(std::ceil(y00 - y11 + 1.0))
     };
 
-    Image565 output{od};
+    output.setDimensions(od);
     output.clear(background);
 
-    rowsRotate(image, output, sinAngle, cosAngle, 0, output.getDimensions().height());
+    rowsRotate(*image, output, sinAngle, cosAngle, 0, od.height());
 
     return output;
 }
@@ -713,22 +1312,23 @@ fb16::Image565
 fb16::rotate90(
     const fb16::Interface565Base& input)
 {
-    const auto id = input.getDimensions();
-    const Dimensions565 od{ id.height(), id.width()};
-    Image565 output{od};
+    Image565 output;
+    rotate90To(input, output);
 
-    for (auto j = 0 ; j < id.height() ; ++j)
-    {
-        for (auto i = 0 ; i < id.width() ; ++i)
-        {
-            const auto pixel{input.getPixel(Point{i, j})};
+    return output;
+}
 
-            if (pixel.has_value())
-            {
-                output.setPixel(Point{id.height() - j - 1, i}, pixel.value());
-            }
-        }
-    }
+//-------------------------------------------------------------------------
+
+fb16::Image565&
+fb16::rotate90To(
+    const fb16::Interface565Base& input,
+    fb16::Image565& output)
+{
+    const auto id = input.getDimensions();
+    output.setDimensions(Dimensions565{id.height(), id.width()});
+
+    rotateQuarter(input, output, true);
 
     return output;
 }
@@ -738,21 +1338,53 @@ fb16::rotate90(
 fb16::Image565
 fb16::rotate180(
     const fb16::Interface565Base& input)
+{
+    Image565 output;
+    rotate180To(input, output);
+
+    return output;
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Interface565Base&
+fb16::rotate180InPlace(
+    fb16::Interface565Base& image)
+{
+    const auto d = image.getDimensions();
+
+    for (auto j = 0 ; j < d.height() / 2 ; ++j)
+    {
+        auto top = image.getRow(j);
+        auto bottom = image.getRow(d.height() - j - 1);
+
+        std::ranges::swap_ranges(top, bottom);
+        std::ranges::reverse(top);
+        std::ranges::reverse(bottom);
+    }
+
+    if (d.height() & 1)
+    {
+        std::ranges::reverse(image.getRow(d.height() / 2));
+    }
+
+    return image;
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Image565&
+fb16::rotate180To(
+    const fb16::Interface565Base& input,
+    fb16::Image565& output)
 {
     const auto d = input.getDimensions();
-    Image565 output{d};
+    output.setDimensions(d);
 
     for (auto j = 0 ; j < d.height() ; ++j)
     {
-        for (auto i = 0 ; i < d.width() ; ++i)
-        {
-            const auto pixel{input.getPixel(Point{i, j})};
-
-            if (pixel.has_value())
-            {
-                output.setPixel(Point{d.width() - i - 1, d.height() - j - 1}, pixel.value());
-            }
-        }
+        std::ranges::reverse_copy(input.getRow(j),
+                                  output.getRow(d.height() - j - 1).begin());
     }
 
     return output;
@@ -764,22 +1396,23 @@ fb16::Image565
 fb16::rotate270(
     const fb16::Interface565Base& input)
 {
-    const auto id = input.getDimensions();
-    const Dimensions565 od{ id.height(), id.width()};
-    Image565 output{od};
+    Image565 output;
+    rotate270To(input, output);
 
-    for (auto j = 0 ; j < id.height() ; ++j)
-    {
-        for (auto i = 0 ; i < id.width() ; ++i)
-        {
-            const auto pixel{input.getPixel(Point{i, j})};
+    return output;
+}
 
-            if (pixel.has_value())
-            {
-                output.setPixel(Point{j, id.width() - i - 1}, pixel.value());
-            }
-        }
-    }
+//-------------------------------------------------------------------------
+
+fb16::Image565&
+fb16::rotate270To(
+    const fb16::Interface565Base& input,
+    fb16::Image565& output)
+{
+    const auto id = input.getDimensions();
+    output.setDimensions(Dimensions565{id.height(), id.width()});
+
+    rotateQuarter(input, output, false);
 
     return output;
 }
@@ -790,26 +1423,102 @@ fb16::Image565
 fb16::scaleUp(
     const fb16::Interface565Base& input,
     uint8_t scale)
+{
+    Image565 output;
+    scaleUpTo(input, output, scale);
+
+    return output;
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Image565&
+fb16::scaleUpTo(
+    const fb16::Interface565Base& input,
+    fb16::Image565& output,
+    uint8_t scale)
 {
     const auto id = input.getDimensions();
-    const Dimensions565 od{id.width() * scale, id.height() * scale};
-    auto inputi = input.getBuffer().data();
-    fb16::Image565 output{od};
+    output.setDimensions(Dimensions565{id.width() * scale, id.height() * scale});
+
+    scaleUpTo(input, output, Point565{0, 0}, scale);
+
+    return output;
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Interface565Base&
+fb16::scaleUpTo(
+    const fb16::Interface565Base& input,
+    fb16::Interface565Base& output,
+    const fb16::Point565 offset,
+    uint8_t scale)
+{
+    if (scale == 0)
+    {
+        return output;
+    }
+
+    const auto id = input.getDimensions();
+
+    // clip the scaled image to the output clip, as putImage() does
+
+    const Rectangle565 destination{offset, Dimensions565{id.width() * scale,
+                                                         id.height() * scale}};
+    const auto visible = output.getClip().intersection(destination);
+
+    if (visible.empty())
+    {
+        return output;
+    }
+
+    const auto xStart = visible.left();
+    const auto xEnd = visible.right() + 1;
+    const auto yStart = visible.top();
+    const auto yEnd = visible.bottom() + 1;
+
+    const auto iStart = (xStart - offset.x()) / scale;
+    const auto lead = (xStart - offset.x()) % scale;
+    const auto width = xEnd - xStart;
 
-    for (int j = 0 ; j < id.height() ; ++j)
+    // expand the first visible row of each block horizontally, then copy
+    // it to the remaining rows in the block
+
+    for (auto y = yStart ; y < yEnd ; )
     {
-        for (int i = 0 ; i < id.width() ; ++i)
+        const auto j = (y - offset.y()) / scale;
+        const auto yBlockEnd = std::min(offset.y() + ((j + 1) * scale), yEnd);
+
+        const auto inputRow = input.getRow(j);
+        const auto outputRow = output.getRow(y).subspan(xStart, width);
+
+        auto* outputi = outputRow.data();
+        auto* outputEnd = outputi + width;
+        auto i = iStart;
+
+        if (lead)
         {
-            auto pixel = *(inputi++);
-            for (int b = 0 ; b < scale ; ++b)
-            {
-                for (int a = 0 ; a < scale ; ++a)
-                {
-                    Point p{(i * scale) + a, (j * scale) + b};
-                    output.setPixel(p, pixel);
-                }
-            }
+            const auto n = std::min(scale - lead, width);
+            outputi = std::fill_n(outputi, n, inputRow[i++]);
+        }
+
+        const auto whole = (outputEnd - outputi) / scale;
+        expandRow(inputRow.data() + i, whole, outputi, scale);
+        outputi += whole * scale;
+        i += whole;
+
+        if (outputi < outputEnd)
+        {
+            std::fill(outputi, outputEnd, inputRow[i]);
         }
+
+        for (auto b = y + 1 ; b < yBlockEnd ; ++b)
+        {
+            std::ranges::copy(outputRow, output.getRow(b).begin() + xStart);
+        }
+
+        y = yBlockEnd;
     }
 
     return output;
@@ -820,12 +1529,35 @@ fb16::scaleUp(
 fb16::Image565
 fb16::toGrey(
     const Interface565Base& input)
+{
+    Image565 output;
+    toGreyTo(input, output);
+
+    return output;
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Interface565Base&
+fb16::toGreyInPlace(
+    Interface565Base& image)
+{
+    rowsToGrey(image, image, 0, image.getDimensions().height());
+
+    return image;
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Image565&
+fb16::toGreyTo(
+    const Interface565Base& input,
+    Image565& output)
 {
     const auto id = input.getDimensions();
-    Image565 output{id};
+    output.setDimensions(id);
 
     rowsToGrey(input, output, 0, id.height());
 
     return output;
 }
-
@@ -46,15 +46,56 @@ boxBlur(
     const Interface565Base& input,
     int radius);
 
+Image565&
+boxBlurTo(
+    const Interface565Base& input,
+    Image565& output,
+    int radius);
+
 [[nodiscard]] Image565
 enlighten(
     const Interface565Base& input,
     double strength);
 
+Interface565Base&
+enlightenInPlace(
+    Interface565Base& image,
+    double strength);
+
+Image565&
+enlightenTo(
+    const Interface565Base& input,
+    Image565& output,
+    double strength);
+
 [[nodiscard]] Image565
 maxRGB(
     const Interface565Base& input);
 
+Image565&
+maxRGBTo(
+    const Interface565Base& input,
+    Image565& output);
+
+// Copy input to output applying the display orientation. The output is
+// not resized, it must already have the (possibly transposed) dimensions.
+
+Interface565Base&
+orientTo(
+    const Interface565Base& input,
+    Interface565Base& output,
+    Orientation565 orientation);
+
+// As above, but only the area of input (in input coordinates) is copied,
+// to wherever it lands in the output.
+
+Interface565Base&
+orientTo(
+    const Interface565Base& input,
+    Interface565Base& output,
+    Orientation565 orientation,
+    const Rectangle565& area);
+
 [[nodiscard]] Image565
 resizeBilinearInterpolation(
     const Interface565Base& input,
@@ -108,27 +149,97 @@ rotate(
     return rotate(input, 0, angle);
 }
 
+Image565&
+rotateTo(
+    const Interface565Base& input,
+    Image565& output,
+    uint32_t background,
+    double angle);
+
+inline Image565&
+rotateTo(
+    const Interface565Base& input,
+    Image565& output,
+    const RGB565& background,
+    double angle)
+{
+    return rotateTo(input, output, background.get565(), angle);
+}
+
+inline Image565&
+rotateTo(
+    const Interface565Base& input,
+    Image565& output,
+    double angle)
+{
+    return rotateTo(input, output, 0, angle);
+}
+
 [[nodiscard]] Image565
 rotate90(
     const Interface565Base& input);
 
+Image565&
+rotate90To(
+    const Interface565Base& input,
+    Image565& output);
+
 [[nodiscard]] Image565
 rotate180(
     const Interface565Base& input);
 
+Interface565Base&
+rotate180InPlace(
+    Interface565Base& image);
+
+Image565&
+rotate180To(
+    const Interface565Base& input,
+    Image565& output);
+
 [[nodiscard]] Image565
 rotate270(
     const Interface565Base& input);
 
+Image565&
+rotate270To(
+    const Interface565Base& input,
+    Image565& output);
+
 [[nodiscard]] Image565
 scaleUp(
     const Interface565Base& input,
     uint8_t scale);
 
+Image565&
+scaleUpTo(
+    const Interface565Base& input,
+    Image565& output,
+    uint8_t scale);
+
+// Scale input directly into output with its top left corner at offset,
+// clipped to the output clip in the same way as putImage().
+
+Interface565Base&
+scaleUpTo(
+    const Interface565Base& input,
+    Interface565Base& output,
+    const Point565 offset,
+    uint8_t scale);
+
 [[nodiscard]] Image565
 toGrey(
     const Interface565Base& input);
 
+Interface565Base&
+toGreyInPlace(
+    Interface565Base& image);
+
+Image565&
+toGreyTo(
+    const Interface565Base& input,
+    Image565& output);
+
 //-------------------------------------------------------------------------
 
 } // namespace fb16
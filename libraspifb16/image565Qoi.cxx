@@ -265,7 +265,7 @@ decodeQoi(
                           rgb.blend(currentRGBA.a, background));
     }
 
-    return fb16::Image565(image);
+    return image;
 }
 
 //-------------------------------------------------------------------------
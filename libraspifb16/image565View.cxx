@@ -0,0 +1,93 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include "image565View.h"
+
+#include <stdexcept>
+
+//-------------------------------------------------------------------------
+
+fb16::Image565View::Image565View(
+    std::span<uint16_t> buffer,
+    Dimensions565 d,
+    int lineLengthPixels)
+:
+    m_buffer{buffer},
+    m_dimensions{d},
+    m_lineLengthPixels{lineLengthPixels}
+{
+    if (lineLengthPixels < d.width())
+    {
+        throw std::invalid_argument("line length is less than image width");
+    }
+
+    // the last line need not be padded, so a view of part of another
+    // image can end at its bottom right corner
+
+    const auto minBufferSize = (d.height() > 0)
+                             ? (static_cast<std::size_t>(lineLengthPixels) *
+                                (d.height() - 1)) + d.width()
+                             : 0;
+
+    if (buffer.size() < minBufferSize)
+    {
+        throw std::invalid_argument("buffer is too small for image dimensions");
+    }
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Image565View::Image565View(
+    Interface565Base& image,
+    const Rectangle565& area)
+:
+    m_buffer{},
+    m_dimensions{area.dimensions()},
+    m_lineLengthPixels{image.getLineLengthPixels()}
+{
+    const Rectangle565 bounds{Point565{0, 0}, image.getDimensions()};
+
+    if (area.empty() or not bounds.contains(area))
+    {
+        throw std::invalid_argument("view area is not inside the image");
+    }
+
+    m_buffer = image.getBuffer().subspan(image.offset(area.topLeft()),
+                                         (static_cast<std::size_t>(m_lineLengthPixels) *
+                                          (area.height() - 1)) + area.width());
+}
+
+//-------------------------------------------------------------------------
+
+std::size_t
+fb16::Image565View::offset(
+    const Point565 p) const noexcept
+{
+    return p.x() + p.y() * m_lineLengthPixels;
+}
+
@@ -0,0 +1,101 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "dimensions.h"
+#include "interface565.h"
+#include "interface565Base.h"
+#include "point.h"
+
+//-------------------------------------------------------------------------
+
+namespace fb16
+{
+
+//-------------------------------------------------------------------------
+
+// A non-owning view of a 565 buffer owned by someone else (for example a
+// mapped frame buffer, or part of another image). The buffer must outlive
+// the view. Drawing on the view draws on the buffer.
+
+class Image565View final
+:
+    public Interface565Base
+{
+public:
+
+    Image565View(
+        std::span<uint16_t> buffer,
+        Dimensions565 d,
+        int lineLengthPixels);
+
+    // A view of the area of image. Throws std::invalid_argument if the
+    // area is empty or not inside the image.
+
+    Image565View(
+        Interface565Base& image,
+        const Rectangle565& area);
+
+    ~Image565View() final = default;
+
+    Image565View(const Image565View&) = default;
+    Image565View(Image565View&&) = default;
+    Image565View& operator=(const Image565View&) = default;
+    Image565View& operator=(Image565View&&) = default;
+
+    [[nodiscard]] Dimensions565 getDimensions() const noexcept final { return m_dimensions; }
+
+    [[nodiscard]] std::span<uint16_t> getBuffer() & noexcept final { return m_buffer; };
+    [[nodiscard]] std::span<const uint16_t> getBuffer() const & noexcept final { return m_buffer; };
+
+    [[nodiscard]] std::span<uint16_t> getBuffer() && noexcept = delete;
+    [[nodiscard]] std::span<const uint16_t> getBuffer() const && noexcept = delete;
+
+    [[nodiscard]] int getLineLengthPixels() const noexcept final { return m_lineLengthPixels; };
+    [[nodiscard]] std::size_t offset(const Point565 p) const noexcept final;
+
+private:
+
+    std::span<uint16_t> m_buffer;
+    Dimensions565 m_dimensions;
+    int m_lineLengthPixels;
+};
+
+//-------------------------------------------------------------------------
+
+} // namespace fb16
+
+//-------------------------------------------------------------------------
+
@@ -35,6 +35,7 @@
 
 #include "dimensions.h"
 #include "point.h"
+#include "rectangle.h"
 #include "rgb565.h"
 
 //-------------------------------------------------------------------------
@@ -46,6 +47,7 @@ namespace fb16
 
 using Dimensions565 = Dimensions<int>;
 using Point565 = Point<int>;
+using Rectangle565 = Rectangle<int>;
 
 //-------------------------------------------------------------------------
 
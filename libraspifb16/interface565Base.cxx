@@ -27,6 +27,7 @@
 
 #include "image565.h"
 #include "interface565Base.h"
+#include "rgb565Kernels.h"
 
 #include <algorithm>
 
@@ -35,7 +36,24 @@
 void
 fb16::Interface565Base::clear(uint16_t rgb)
 {
-    std::ranges::fill(getBufferStart(), rgb);
+    damageAll();
+
+    const auto& kernels = rgb565Kernels();
+    const auto fill = (deviceMemory()) ? kernels.fillStream : kernels.fill;
+    const auto d = getDimensions();
+
+    if (getLineLengthPixels() == d.width())
+    {
+        fill(rgb, getBufferStart());
+        return;
+    }
+
+    // skip the padding at the end of each line
+
+    for (auto y = 0 ; y < d.height() ; ++y)
+    {
+        fill(rgb, getRow(y));
+    }
 }
 
 //-------------------------------------------------------------------------
@@ -58,7 +76,7 @@ fb16::Interface565Base::setPixel(
     const Point565 p,
     uint16_t rgb)
 {
-    bool isValid{validPixel(p)};
+    bool isValid{clipPixel(p)};
 
     if (isValid)
     {
@@ -152,25 +170,23 @@ fb16::Interface565Base::putImage(
     const Point565 p,
     const Interface565Base& image)
 {
-    const auto id = image.getDimensions();
-    const auto d = getDimensions();
+    const auto clip = getClip();
+    const Rectangle565 destination{p, image.getDimensions()};
+    const auto visible = clip.intersection(destination);
 
-    if ((p.x() < 0) or
-        ((p.x() + id.width()) > d.width()))
+    if (visible.empty())
     {
-        return putImagePartial(p, image);
+        return false;
     }
 
-    if ((p.y() < 0) or
-        ((p.y() + id.height()) > d.height()))
-    {
-        return putImagePartial(p, image);
-    }
+    const auto xStart = visible.left() - p.x();
+    const auto yStart = visible.top() - p.y();
+    const auto width = visible.width();
 
-    for (int j = 0 ; j < id.height() ; ++j)
+    for (int j = 0 ; j < visible.height() ; ++j)
     {
-        auto row = image.getRow(j);
-        const auto ost = offset(Point565{p.x(), j + p.y()});
+        auto row = image.getRow(j + yStart).subspan(xStart, width);
+        const auto ost = offset(Point565{visible.left(), j + visible.top()});
 
         std::ranges::copy(row, begin(getBuffer().subspan(ost)));
     }
@@ -180,71 +196,69 @@ fb16::Interface565Base::putImage(
 
 //-------------------------------------------------------------------------
 
-bool
-fb16::Interface565Base::putImagePartial(
-    const Point565 p,
-    const Interface565Base& image)
+void
+fb16::Interface565Base::pushClip(
+    const Rectangle565& clip)
 {
-    const auto id = image.getDimensions();
-    const auto d = getDimensions();
-
-    auto x = p.x();
-    auto xStart = 0;
-    auto xEnd = id.width() - 1;
+    m_clips.push_back(getClip().intersection(clip));
+}
 
-    auto y = p.y();
-    auto yStart = 0;
-    auto yEnd = id.height() - 1;
+//-------------------------------------------------------------------------
 
-    if (x < 0)
+void
+fb16::Interface565Base::popClip() noexcept
+{
+    if (not m_clips.empty())
     {
-        xStart = -x;
-        x = 0;
+        m_clips.pop_back();
     }
+}
 
-    if ((x - xStart + id.width()) > d.width())
-    {
-        xEnd = d.width() - 1 - (x - xStart);
-    }
+//-------------------------------------------------------------------------
 
-    if (y < 0)
+fb16::Rectangle565
+fb16::Interface565Base::getClip() const noexcept
+{
+    if (m_clips.empty())
     {
-        yStart = -y;
-        y = 0;
+        return Rectangle565{Point565{0, 0}, getDimensions()};
     }
 
-    if ((y - yStart + id.height()) > d.height())
-    {
-        yEnd = d.height() - 1 - (y - yStart);
-    }
+    return m_clips.back();
+}
 
-    if ((xEnd - xStart) <= 0)
-    {
-        return false;
-    }
+//-------------------------------------------------------------------------
+
+void
+fb16::Interface565Base::clipToSurface() noexcept
+{
+    const Rectangle565 surface{Point565{0, 0}, getDimensions()};
 
-    if ((yEnd - yStart) <= 0)
+    for (auto& clip : m_clips)
     {
-        return false;
+        clip = surface.intersection(clip);
     }
+}
 
-    const auto xLength = xEnd - xStart + 1;
+//-------------------------------------------------------------------------
 
-    for (auto j = yStart ; j <= yEnd ; ++j)
-    {
-        auto row = image.getRow(j).subspan(xStart, xLength);
-        const auto ost = offset(Point565{x, j - yStart + y});
+void
+fb16::Interface565Base::addDamage(
+    const Rectangle565& area)
+{
+    const Rectangle565 surface{Point565{0, 0}, getDimensions()};
+    const auto damage = surface.intersection(area);
 
-        std::ranges::copy(row, begin(getBuffer().subspan(ost)));
+    if (not damage.empty())
+    {
+        m_damage.push_back(damage);
     }
-
-    return true;
 }
 
 //-------------------------------------------------------------------------
 
 std::span<uint16_t>
-fb16::Interface565Base::getBufferStart() & noexcept
+fb16::Interface565Base::getBufferStart() &
 {
     return getBuffer().subspan(offset(Point565{0, 0}),
                                getLineLengthPixels() * getDimensions().height());
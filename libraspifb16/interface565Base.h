@@ -31,6 +31,7 @@
 #include <cstdint>
 #include <optional>
 #include <span>
+#include <vector>
 
 #include "dimensions.h"
 #include "interface565.h"
@@ -44,6 +45,19 @@ namespace fb16
 
 //-------------------------------------------------------------------------
 
+// Clockwise rotation from the logical (drawing) coordinates to the
+// physical display.
+
+enum class Orientation565
+{
+    ROTATE_0,
+    ROTATE_90,
+    ROTATE_180,
+    ROTATE_270
+};
+
+//-------------------------------------------------------------------------
+
 class Interface565Base
 :
     public Interface565
@@ -85,6 +99,23 @@ public:
 
     bool putImage(const Point565, const Interface565Base&);
 
+    // Drawing is limited to the clip rectangle on top of the clip stack.
+    // Each rectangle pushed is intersected with the one below it, so a
+    // panel can not draw outside of its parent. Reading pixels is not
+    // clipped. The stack is kept inside the surface, so clipPixel() only
+    // has to test the top of it.
+
+    void pushClip(const Rectangle565& clip);
+    void popClip() noexcept;
+
+    [[nodiscard]] Rectangle565 getClip() const noexcept;
+
+    [[nodiscard]] bool
+    clipPixel(const Point565 p) const
+    {
+        return (m_clips.empty()) ? validPixel(p) : m_clips.back().contains(p);
+    }
+
     [[nodiscard]] bool
     validPixel(const Point565 p) const override
     {
@@ -96,7 +127,8 @@ public:
                (p.y() < d.height());
     }
 
-    [[nodiscard]] virtual std::span<uint16_t> getBuffer() & noexcept = 0;
+    // May allocate, for an image that shares its pixels with a copy.
+    [[nodiscard]] virtual std::span<uint16_t> getBuffer() & = 0;
     [[nodiscard]] virtual std::span<const uint16_t> getBuffer() const & noexcept = 0;
 
     [[nodiscard]] std::span<uint16_t> getBuffer() && noexcept = delete;
@@ -105,18 +137,98 @@ public:
     [[nodiscard]] virtual int getLineLengthPixels() const noexcept = 0;
     [[nodiscard]] virtual size_t offset(const Point565 p) const noexcept = 0;
 
+    // True when drawing goes straight to device memory (a mapped frame
+    // buffer), which is better filled with non-temporal stores.
+
+    [[nodiscard]] virtual bool deviceMemory() const noexcept { return false; }
+
     [[nodiscard]] virtual bool ownable() const noexcept { return false; }
     [[nodiscard]] virtual bool owned() noexcept { return false; }
     virtual void own() noexcept {}
     virtual void disown() noexcept {}
 
+    [[nodiscard]] virtual Orientation565 getOrientation() const noexcept { return Orientation565::ROTATE_0; }
+    virtual bool setOrientation(Orientation565 orientation) { return orientation == Orientation565::ROTATE_0; }
+
     virtual bool update() { return false; }
 
+    // Report an area that has changed since the last update(), so that
+    // update() only has to copy or rotate what changed. Areas are clipped
+    // to the surface.
+    //
+    // Reporting damage switches update() to partial updates for the whole
+    // surface, not just for whoever reported it: anything drawn and not
+    // reported is not copied out. A program that reports damage must
+    // therefore report everything it draws, for every update. If nothing
+    // was reported, the whole surface is assumed to have changed. The
+    // whole surface is also updated after clear(), and on the first
+    // update, whatever was reported.
+
+    void addDamage(const Rectangle565& area);
+
+    // The areas for update() to copy or rotate, or none when it has to do
+    // the whole surface.
+
+    [[nodiscard]] std::span<const Rectangle565>
+    getDamage() const noexcept
+    {
+        return (m_damageAll) ? std::span<const Rectangle565>{} : m_damage;
+    }
+
+    [[nodiscard]] bool damageReported() const noexcept { return not m_damage.empty(); }
+
+    void
+    clearDamage() noexcept
+    {
+        m_damage.clear();
+        m_damageAll = false;
+    }
+
+protected:
+
+    // The whole surface has changed, so the next update() must copy or
+    // rotate all of it, whatever damage is reported.
+
+    void damageAll() noexcept { m_damageAll = true; }
+
+    // The dimensions have changed, so shrink the clip stack to fit.
+
+    void clipToSurface() noexcept;
+
 private:
 
-    bool putImagePartial(const Point565 p, const Interface565Base& image);
+    std::span<uint16_t> getBufferStart() &;
+
+    std::vector<Rectangle565> m_clips{};
+    std::vector<Rectangle565> m_damage{};
+    bool m_damageAll{true};
+};
+
+//-------------------------------------------------------------------------
+
+// Push a clip rectangle for the lifetime of the scope.
+
+class ScopedClip565
+{
+public:
+
+    ScopedClip565(
+        Interface565Base& iface,
+        const Rectangle565& clip)
+    :
+        m_iface{iface}
+    {
+        m_iface.pushClip(clip);
+    }
+
+    ~ScopedClip565() { m_iface.popClip(); }
+
+    ScopedClip565(const ScopedClip565&) = delete;
+    ScopedClip565& operator=(const ScopedClip565&) = delete;
+
+private:
 
-    std::span<uint16_t> getBufferStart() & noexcept;
+    Interface565Base& m_iface;
 };
 
 //-------------------------------------------------------------------------
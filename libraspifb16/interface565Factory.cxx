@@ -26,6 +26,7 @@
 //-------------------------------------------------------------------------
 
 #include <cstdlib>
+#include <stdexcept>
 #include <string>
 #include <system_error>
 
@@ -41,11 +42,64 @@
 
 namespace
 {
+
+//-------------------------------------------------------------------------
+
 const std::string defaultFrameBufferDevice{"/dev/fb1"};
+
+//-------------------------------------------------------------------------
+
+std::unique_ptr<fb16::Interface565Base>
+orientInterface565(
+    std::unique_ptr<fb16::Interface565Base> fb)
+{
+    const auto* orientationString = std::getenv("RASPIFB16_ORIENTATION");
+
+    if ((orientationString == nullptr) or (*orientationString == '\0'))
+    {
+        return fb;
+    }
+
+    const std::string orientationName{orientationString};
+    auto orientation{fb16::Orientation565::ROTATE_0};
+
+    if (orientationName == "0")
+    {
+        orientation = fb16::Orientation565::ROTATE_0;
+    }
+    else if (orientationName == "90")
+    {
+        orientation = fb16::Orientation565::ROTATE_90;
+    }
+    else if (orientationName == "180")
+    {
+        orientation = fb16::Orientation565::ROTATE_180;
+    }
+    else if (orientationName == "270")
+    {
+        orientation = fb16::Orientation565::ROTATE_270;
+    }
+    else
+    {
+        throw std::invalid_argument("RASPIFB16_ORIENTATION must be 0, 90, 180 or 270, not " +
+                                    orientationName);
+    }
+
+    if (not fb->setOrientation(orientation))
+    {
+        throw std::invalid_argument("cannot rotate the display by RASPIFB16_ORIENTATION " +
+                                    orientationName);
+    }
+
+    return fb;
 }
 
 //-------------------------------------------------------------------------
 
+} // namespace
+
+//-------------------------------------------------------------------------
+
 namespace fb16
 {
 
@@ -67,7 +121,7 @@ createInterface565(
             interfaceDevice = defaultFrameBufferDevice;
         }
 
-        return std::make_unique<FrameBuffer565>(interfaceDevice);
+        return orientInterface565(std::make_unique<FrameBuffer565>(interfaceDevice));
 
         break;
 
@@ -91,7 +145,7 @@ createInterface565(
             }
         }
 
-        return std::make_unique<DumbBuffer565>(interfaceDevice, connectorId);
+        return orientInterface565(std::make_unique<DumbBuffer565>(interfaceDevice, connectorId));
     }
 #else
         throw std::invalid_argument("There is no KMSDRM library installed");
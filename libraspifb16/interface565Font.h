@@ -29,6 +29,10 @@
 
 //-------------------------------------------------------------------------
 
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <span>
 #include <string>
 #include <string_view>
 
@@ -55,6 +59,12 @@ public:
         DEGREE_SYMBOL
     };
 
+    // A row of glyph coverage, from 0 (none) to 255 (solid), for the
+    // pixels from p rightwards. If lcd is true there are three coverages,
+    // red, green and blue, for each pixel (LCD subpixel glyphs).
+
+    using CoverageSink = std::function<void(Point565 p, std::span<const uint8_t> coverage, bool lcd)>;
+
     Interface565Font() = default;
     virtual ~Interface565Font() = default;
 
@@ -96,6 +106,39 @@ public:
         std::string_view sv,
         const RGB565& rgb,
         Interface565& image) = 0;
+
+    // Lay out sv from p exactly as drawString() does, but pass the
+    // coverage of each row of each glyph, in drawing order, to sink
+    // instead of drawing it. Returns the position drawString() would.
+
+    virtual Point565
+    drawCoverage(
+        const Point565 p,
+        std::string_view sv,
+        const CoverageSink& sink) = 0;
+
+    // Changes each time the pixels the font draws change (its size, style
+    // or rendering), so a cache of what it drew can tell it is out of date.
+    // Revisions are never reused, not even by another font, so a cache can
+    // not mistake a new font at the address of an old one for the old one.
+
+    [[nodiscard]] uint64_t getRevision() const noexcept { return m_revision; }
+
+protected:
+
+    void changed() noexcept { m_revision = nextRevision(); }
+
+private:
+
+    static uint64_t
+    nextRevision() noexcept
+    {
+        static std::atomic<uint64_t> revision{0};
+
+        return ++revision;
+    }
+
+    uint64_t m_revision{nextRevision()};
 };
 
 //-------------------------------------------------------------------------
@@ -0,0 +1,334 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+
+#include "paint565.h"
+
+//=========================================================================
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+// 4x4 Bayer matrix, thresholds from 0 to 15.
+
+constexpr std::array<std::array<int, 4>, 4> c_bayer
+{{
+    {  0,  8,  2, 10 },
+    { 12,  4, 14,  6 },
+    {  3, 11,  1,  9 },
+    { 15,  7, 13,  5 }
+}};
+
+//-------------------------------------------------------------------------
+
+constexpr int
+wrap(
+    int value,
+    int size) noexcept
+{
+    const auto result = value % size;
+    return (result < 0) ? result + size : result;
+}
+
+//-------------------------------------------------------------------------
+
+} // namespace
+
+//=========================================================================
+
+fb16::Gradient565::Gradient565(
+    std::span<const GradientStop> stops,
+    GradientSpread spread,
+    bool dither)
+:
+    m_ramp{},
+    m_ramp565{},
+    m_spread{spread},
+    m_dither{dither}
+{
+    if (stops.empty())
+    {
+        throw std::invalid_argument("a gradient needs at least one stop");
+    }
+
+    std::vector<GradientStop> sorted(stops.begin(), stops.end());
+    std::ranges::stable_sort(sorted, {}, &GradientStop::offset);
+
+    auto channel = [](uint8_t a, uint8_t b, float t) -> uint8_t
+    {
+        return static_cast<uint8_t>(std::lround(a + ((b - a) * t)));
+    };
+
+    m_ramp.reserve(c_rampSize);
+    m_ramp565.reserve(c_rampSize);
+
+    auto scale = [](uint8_t value, int maximum)
+    {
+        return static_cast<uint16_t>(((value * maximum * 16) + 127) / 255);
+    };
+
+    auto stop = sorted.begin();
+
+    for (auto i = 0; i < c_rampSize; ++i)
+    {
+        const auto offset = static_cast<float>(i) / (c_rampSize - 1);
+
+        while (((stop + 1) != sorted.end()) and ((stop + 1)->offset <= offset))
+        {
+            ++stop;
+        }
+
+        auto colour = stop->colour;
+
+        if ((offset > stop->offset) and ((stop + 1) != sorted.end()))
+        {
+            const auto& next = *(stop + 1);
+            const auto t = (offset - stop->offset) / (next.offset - stop->offset);
+
+            colour = RGB8{channel(stop->colour.red, next.colour.red, t),
+                          channel(stop->colour.green, next.colour.green, t),
+                          channel(stop->colour.blue, next.colour.blue, t)};
+        }
+
+        const Level level{scale(colour.red, 31),
+                          scale(colour.green, 63),
+                          scale(colour.blue, 31)};
+
+        m_ramp.push_back(level);
+        m_ramp565.push_back(static_cast<uint16_t>((((level.red + 8) >> 4) << 11) |
+                                                  (((level.green + 8) >> 4) << 5) |
+                                                  ((level.blue + 8) >> 4)));
+    }
+}
+
+//-------------------------------------------------------------------------
+
+int
+fb16::Gradient565::index(
+    int64_t position) const noexcept
+{
+    constexpr int64_t one{int64_t{1} << c_positionBits};
+
+    switch (m_spread)
+    {
+    case GradientSpread::PAD:
+
+        position = std::clamp(position, int64_t{0}, one - 1);
+        break;
+
+    case GradientSpread::REPEAT:
+
+        position &= one - 1;
+        break;
+
+    case GradientSpread::REFLECT:
+
+        position &= (2 * one) - 1;
+
+        if (position >= one)
+        {
+            position = (2 * one) - 1 - position;
+        }
+
+        break;
+    }
+
+    return static_cast<int>(position >> (c_positionBits - 8));
+}
+
+//-------------------------------------------------------------------------
+
+void
+fb16::Gradient565::put(
+    uint16_t& pixel,
+    int64_t position,
+    int x,
+    int y) const noexcept
+{
+    const auto i = index(position);
+
+    if (not m_dither)
+    {
+        pixel = m_ramp565[i];
+        return;
+    }
+
+    // Adding a threshold from 0 to 15 before the four extra bits are
+    // dropped rounds up in proportion to the fraction lost.
+
+    const auto threshold = c_bayer[y & 3][x & 3];
+    const auto& level = m_ramp[i];
+
+    pixel = static_cast<uint16_t>((((level.red + threshold) >> 4) << 11) |
+                                  (((level.green + threshold) >> 4) << 5) |
+                                  ((level.blue + threshold) >> 4));
+}
+
+//=========================================================================
+
+fb16::LinearGradient565::LinearGradient565(
+    Point565 start,
+    Point565 end,
+    std::span<const GradientStop> stops,
+    GradientSpread spread,
+    bool dither)
+:
+    Gradient565(stops, spread, dither),
+    m_start{start},
+    m_dx{},
+    m_dy{}
+{
+    const double dx = end.x() - start.x();
+    const double dy = end.y() - start.y();
+    const auto length2 = (dx * dx) + (dy * dy);
+
+    // the offset of a pixel is its projection on to the line from start
+    // to end, divided by the length of that line
+
+    if (length2 > 0.0)
+    {
+        m_dx = dx / length2;
+        m_dy = dy / length2;
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+fb16::LinearGradient565::fillSpan(
+    std::span<uint16_t> pixels,
+    int x,
+    int y) const
+{
+    constexpr double scale = static_cast<double>(int64_t{1} << c_positionBits);
+
+    const auto offset = ((x - m_start.x()) * m_dx) + ((y - m_start.y()) * m_dy);
+
+    auto position = static_cast<int64_t>(std::llround(offset * scale));
+    const auto step = static_cast<int64_t>(std::llround(m_dx * scale));
+
+    for (auto& pixel : pixels)
+    {
+        put(pixel, position, x, y);
+        position += step;
+        ++x;
+    }
+}
+
+//=========================================================================
+
+fb16::RadialGradient565::RadialGradient565(
+    Point565 centre,
+    int radius,
+    std::span<const GradientStop> stops,
+    GradientSpread spread,
+    bool dither)
+:
+    Gradient565(stops, spread, dither),
+    m_centre{centre},
+    m_scale{}
+{
+    if (radius < 1)
+    {
+        throw std::invalid_argument("gradient radius must be at least one pixel");
+    }
+
+    m_scale = static_cast<float>(int64_t{1} << c_positionBits) / radius;
+}
+
+//-------------------------------------------------------------------------
+
+void
+fb16::RadialGradient565::fillSpan(
+    std::span<uint16_t> pixels,
+    int x,
+    int y) const
+{
+    // the squared distance from the centre is stepped along the span,
+    // leaving one square root for each pixel
+
+    const auto dy = static_cast<float>(y - m_centre.y());
+    auto dx = static_cast<float>(x - m_centre.x());
+    auto distance2 = (dx * dx) + (dy * dy);
+
+    for (auto& pixel : pixels)
+    {
+        put(pixel, static_cast<int64_t>(std::sqrt(distance2) * m_scale), x, y);
+        distance2 += (2.0f * dx) + 1.0f;
+        dx += 1.0f;
+        ++x;
+    }
+}
+
+//=========================================================================
+
+fb16::Pattern565::Pattern565(
+    const Interface565Base& tile,
+    Point565 origin)
+:
+    m_tile{tile},
+    m_origin{origin}
+{
+    const auto d = m_tile.getDimensions();
+
+    if ((d.width() < 1) or (d.height() < 1))
+    {
+        throw std::invalid_argument("pattern tile is empty");
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+fb16::Pattern565::fillSpan(
+    std::span<uint16_t> pixels,
+    int x,
+    int y) const
+{
+    const auto d = m_tile.getDimensions();
+    const auto row = m_tile.getRow(wrap(y - m_origin.y(), d.height()));
+
+    auto column = wrap(x - m_origin.x(), d.width());
+
+    while (not pixels.empty())
+    {
+        const auto length = std::min(pixels.size(),
+                                     static_cast<std::size_t>(d.width() - column));
+
+        std::copy_n(row.begin() + column, length, pixels.begin());
+        pixels = pixels.subspan(length);
+        column = 0;
+    }
+}
+
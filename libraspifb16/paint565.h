@@ -0,0 +1,226 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "image565.h"
+#include "interface565.h"
+#include "interface565Base.h"
+#include "point.h"
+#include "rgb565.h"
+
+//-------------------------------------------------------------------------
+
+namespace fb16
+{
+
+//-------------------------------------------------------------------------
+
+// Colours for the filled shapes in image565Graphics.h that take a paint
+// in place of a single colour. The shapes are filled a span at a time,
+// and the paint works out the colours of each span incrementally.
+
+class Paint565
+{
+public:
+
+    Paint565() = default;
+    virtual ~Paint565() = default;
+
+    Paint565(const Paint565&) = default;
+    Paint565(Paint565&&) = default;
+    Paint565& operator=(const Paint565&) = default;
+    Paint565& operator=(Paint565&&) = default;
+
+    // Fill pixels, which are on row y of the surface starting at column x.
+
+    virtual void
+    fillSpan(
+        std::span<uint16_t> pixels,
+        int x,
+        int y) const = 0;
+};
+
+//-------------------------------------------------------------------------
+
+struct GradientStop
+{
+    float offset;
+    RGB8 colour;
+};
+
+// What a gradient does beyond its end points. PAD continues the end
+// colours, REPEAT starts again and REFLECT runs back the other way.
+
+enum class GradientSpread
+{
+    PAD,
+    REPEAT,
+    REFLECT
+};
+
+//-------------------------------------------------------------------------
+
+// The colour ramp shared by the gradients, looked up from a table. With
+// dither set, colours are ordered (Bayer) dithered down to 565, which
+// hides the banding of smooth gradients at the same cost as a flat fill.
+// Stops are sorted by offset, and must have offsets from 0 to 1.
+
+class Gradient565
+:
+    public Paint565
+{
+public:
+
+    Gradient565(
+        std::span<const GradientStop> stops,
+        GradientSpread spread,
+        bool dither);
+
+protected:
+
+    // Gradient positions are 32.32 fixed point, with the ramp from 0 to
+    // 1.0 (1 << 32), so that stepping along a long span does not drift.
+
+    static constexpr int c_positionBits{32};
+
+    void
+    put(
+        uint16_t& pixel,
+        int64_t position,
+        int x,
+        int y) const noexcept;
+
+private:
+
+    static constexpr int c_rampSize{256};
+
+    [[nodiscard]] int index(int64_t position) const noexcept;
+
+    // ramp colours scaled to 565, with four extra bits for dithering
+
+    struct Level
+    {
+        uint16_t red;
+        uint16_t green;
+        uint16_t blue;
+    };
+
+    std::vector<Level> m_ramp;
+    std::vector<uint16_t> m_ramp565;
+    GradientSpread m_spread;
+    bool m_dither;
+};
+
+//-------------------------------------------------------------------------
+
+// A gradient from start (offset 0) to end (offset 1), constant at right
+// angles to the line between them.
+
+class LinearGradient565
+:
+    public Gradient565
+{
+public:
+
+    LinearGradient565(
+        Point565 start,
+        Point565 end,
+        std::span<const GradientStop> stops,
+        GradientSpread spread = GradientSpread::PAD,
+        bool dither = true);
+
+    void fillSpan(std::span<uint16_t> pixels, int x, int y) const override;
+
+private:
+
+    Point565 m_start;
+    double m_dx;
+    double m_dy;
+};
+
+//-------------------------------------------------------------------------
+
+// A gradient from the centre (offset 0) out to radius (offset 1).
+
+class RadialGradient565
+:
+    public Gradient565
+{
+public:
+
+    RadialGradient565(
+        Point565 centre,
+        int radius,
+        std::span<const GradientStop> stops,
+        GradientSpread spread = GradientSpread::PAD,
+        bool dither = true);
+
+    void fillSpan(std::span<uint16_t> pixels, int x, int y) const override;
+
+private:
+
+    Point565 m_centre;
+    float m_scale;
+};
+
+//-------------------------------------------------------------------------
+
+// An image repeated across the surface, with its top left corner at
+// origin. The image is copied.
+
+class Pattern565
+:
+    public Paint565
+{
+public:
+
+    explicit Pattern565(
+        const Interface565Base& tile,
+        Point565 origin = Point565{0, 0});
+
+    void fillSpan(std::span<uint16_t> pixels, int x, int y) const override;
+
+private:
+
+    Image565 m_tile;
+    Point565 m_origin;
+};
+
+//-------------------------------------------------------------------------
+
+} // namespace fb16
+
+//-------------------------------------------------------------------------
+
@@ -0,0 +1,166 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <algorithm>
+
+#include "dimensions.h"
+#include "point.h"
+
+//-------------------------------------------------------------------------
+
+namespace fb16
+{
+
+//-------------------------------------------------------------------------
+
+// An axis aligned rectangle of pixels. The right and bottom edges are
+// inclusive, matching the corner points taken by box() and boxFilled().
+
+template<typename T>
+class Rectangle
+{
+public:
+
+    constexpr Rectangle() noexcept
+    :
+        m_x{},
+        m_y{},
+        m_width{},
+        m_height{}
+    {
+    }
+
+    constexpr Rectangle(
+        Point<T> topLeft,
+        Dimensions<T> d) noexcept
+    :
+        m_x(topLeft.x()),
+        m_y(topLeft.y()),
+        m_width(d.width()),
+        m_height(d.height())
+    {
+    }
+
+    constexpr Rectangle(
+        Point<T> p1,
+        Point<T> p2) noexcept
+    :
+        m_x(std::min(p1.x(), p2.x())),
+        m_y(std::min(p1.y(), p2.y())),
+        m_width(std::max(p1.x(), p2.x()) - m_x + 1),
+        m_height(std::max(p1.y(), p2.y()) - m_y + 1)
+    {
+    }
+
+    [[nodiscard]] constexpr T left() const noexcept { return m_x; }
+    [[nodiscard]] constexpr T top() const noexcept { return m_y; }
+    [[nodiscard]] constexpr T right() const noexcept { return m_x + m_width - 1; }
+    [[nodiscard]] constexpr T bottom() const noexcept { return m_y + m_height - 1; }
+
+    [[nodiscard]] constexpr T width() const noexcept { return m_width; }
+    [[nodiscard]] constexpr T height() const noexcept { return m_height; }
+
+    [[nodiscard]] constexpr Point<T> topLeft() const noexcept { return {m_x, m_y}; }
+    [[nodiscard]] constexpr Dimensions<T> dimensions() const noexcept { return {m_width, m_height}; }
+
+    [[nodiscard]] constexpr bool
+    empty() const noexcept
+    {
+        return (m_width <= 0) or (m_height <= 0);
+    }
+
+    [[nodiscard]] constexpr bool
+    contains(
+        Point<T> p) const noexcept
+    {
+        return (p.x() >= m_x) and
+               (p.y() >= m_y) and
+               (p.x() < (m_x + m_width)) and
+               (p.y() < (m_y + m_height));
+    }
+
+    [[nodiscard]] constexpr bool
+    contains(
+        const Rectangle& r) const noexcept
+    {
+        return r.empty() or
+               ((r.m_x >= m_x) and
+                (r.m_y >= m_y) and
+                ((r.m_x + r.m_width) <= (m_x + m_width)) and
+                ((r.m_y + r.m_height) <= (m_y + m_height)));
+    }
+
+    // The overlap of two rectangles, with zero width and height when
+    // they do not overlap.
+
+    [[nodiscard]] constexpr Rectangle
+    intersection(
+        const Rectangle& r) const noexcept
+    {
+        const auto x1 = std::max(m_x, r.m_x);
+        const auto y1 = std::max(m_y, r.m_y);
+        const auto x2 = std::min(m_x + m_width, r.m_x + r.m_width);
+        const auto y2 = std::min(m_y + m_height, r.m_y + r.m_height);
+
+        if ((x2 <= x1) or (y2 <= y1))
+        {
+            return Rectangle{Point<T>{x1, y1}, Dimensions<T>{}};
+        }
+
+        return Rectangle{Point<T>{x1, y1}, Dimensions<T>{x2 - x1, y2 - y1}};
+    }
+
+    constexpr void
+    translate(
+        T dx,
+        T dy) noexcept
+    {
+        m_x += dx;
+        m_y += dy;
+    }
+
+    friend bool operator==(const Rectangle& lhs, const Rectangle& rhs) = default;
+
+private:
+
+    T m_x;
+    T m_y;
+    T m_width;
+    T m_height;
+};
+
+//-------------------------------------------------------------------------
+
+} // namespace fb16
+
+//-------------------------------------------------------------------------
+
@@ -0,0 +1,698 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "rgb565.h"
+#include "rgb565Kernels.h"
+
+//-------------------------------------------------------------------------
+
+// The vector kernels are written with GCC vector extensions. On x86 each
+// one is compiled for both AVX2 and the baseline instruction set, and the
+// version to use is picked when the library is loaded. Elsewhere they
+// compile to whatever SIMD the target has (NEON on aarch64).
+
+#if defined(__x86_64__)
+#define RGB565_KERNEL_CLONES __attribute__((target_clones("avx2", "default")))
+#else
+#define RGB565_KERNEL_CLONES
+#endif
+
+//=========================================================================
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+// x / 1000 for x <= 255000, as (x / 8) / 125.
+
+constexpr uint32_t
+divide1000(
+    uint32_t x) noexcept
+{
+    return ((x >> 3) * 33555) >> 22;
+}
+
+//-------------------------------------------------------------------------
+
+// x / 255 for x <= 65025.
+
+constexpr uint32_t
+divide255(
+    uint32_t x) noexcept
+{
+    return (x + 1 + (x >> 8)) >> 8;
+}
+
+//-------------------------------------------------------------------------
+
+constexpr uint8_t
+blendChannelScalar(
+    uint32_t foreground,
+    uint32_t alpha,
+    uint32_t background) noexcept
+{
+    return divide255((foreground * alpha) + (background * (255 - alpha)));
+}
+
+//-------------------------------------------------------------------------
+
+constexpr uint16_t
+blendScalar(
+    fb16::RGB8 foreground,
+    uint8_t alpha,
+    uint16_t background) noexcept
+{
+    const fb16::RGB8 b{background};
+
+    return fb16::RGB565::rgbTo565(blendChannelScalar(foreground.red, alpha, b.red),
+                                  blendChannelScalar(foreground.green, alpha, b.green),
+                                  blendChannelScalar(foreground.blue, alpha, b.blue));
+}
+
+//=========================================================================
+// Scalar reference kernels.
+
+void
+unpackScalar(
+    std::span<const uint16_t> input,
+    std::span<uint8_t> red,
+    std::span<uint8_t> green,
+    std::span<uint8_t> blue)
+{
+    for (std::size_t i = 0 ; i < input.size() ; ++i)
+    {
+        const fb16::RGB8 rgb{input[i]};
+
+        red[i] = rgb.red;
+        green[i] = rgb.green;
+        blue[i] = rgb.blue;
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+packScalar(
+    std::span<const uint8_t> red,
+    std::span<const uint8_t> green,
+    std::span<const uint8_t> blue,
+    std::span<uint16_t> output)
+{
+    for (std::size_t i = 0 ; i < output.size() ; ++i)
+    {
+        output[i] = fb16::RGB565::rgbTo565(red[i], green[i], blue[i]);
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+greyScalar(
+    std::span<const uint16_t> input,
+    std::span<uint16_t> output)
+{
+    for (std::size_t i = 0 ; i < input.size() ; ++i)
+    {
+        output[i] = fb16::RGB565(input[i]).toGrey().get565();
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+maxChannelScalar(
+    std::span<const uint16_t> input,
+    std::span<uint16_t> output)
+{
+    for (std::size_t i = 0 ; i < input.size() ; ++i)
+    {
+        const fb16::RGB8 rgb{input[i]};
+        const auto grey = std::max({rgb.red, rgb.green, rgb.blue});
+
+        output[i] = fb16::RGB565::rgbTo565(grey, grey, grey);
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+scaleScalar(
+    std::span<const uint16_t> input,
+    std::span<const uint32_t> scales,
+    std::span<uint16_t> output)
+{
+    for (std::size_t i = 0 ; i < input.size() ; ++i)
+    {
+        const fb16::RGB8 rgb{input[i]};
+        const auto scale = scales[i];
+
+        auto channel = [scale](uint32_t c) -> uint8_t
+        {
+            return std::min((c * scale) >> 16, 255U);
+        };
+
+        output[i] = fb16::RGB565::rgbTo565(channel(rgb.red),
+                                           channel(rgb.green),
+                                           channel(rgb.blue));
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+blendScalar(
+    uint16_t foreground,
+    uint8_t alpha,
+    std::span<uint16_t> buffer)
+{
+    const fb16::RGB8 f{foreground};
+
+    for (auto& pixel : buffer)
+    {
+        pixel = blendScalar(f, alpha, pixel);
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+blendCoverageScalar(
+    uint16_t foreground,
+    std::span<const uint8_t> coverage,
+    std::span<uint16_t> buffer)
+{
+    const fb16::RGB8 f{foreground};
+
+    for (std::size_t i = 0 ; i < buffer.size() ; ++i)
+    {
+        buffer[i] = blendScalar(f, coverage[i], buffer[i]);
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+blendCoverageLcdScalar(
+    uint16_t foreground,
+    std::span<const uint8_t> coverage,
+    std::span<uint16_t> buffer)
+{
+    const fb16::RGB8 f{foreground};
+
+    for (std::size_t i = 0 ; i < buffer.size() ; ++i)
+    {
+        const fb16::RGB8 b{buffer[i]};
+        const auto* alpha{coverage.data() + (i * 3)};
+
+        buffer[i] = fb16::RGB565::rgbTo565(blendChannelScalar(f.red, alpha[0], b.red),
+                                           blendChannelScalar(f.green, alpha[1], b.green),
+                                           blendChannelScalar(f.blue, alpha[2], b.blue));
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+fillScalar(
+    uint16_t rgb,
+    std::span<uint16_t> buffer)
+{
+    std::ranges::fill(buffer, rgb);
+}
+
+//=========================================================================
+// Vector kernels. Each processes c_lanes pixels at a time and finishes
+// the row with the scalar kernel. The helpers must always be inlined, as
+// the AVX2 and baseline versions pass wide vectors differently.
+
+constexpr std::size_t c_lanes{16};
+
+using Vector8 = uint8_t __attribute__((vector_size(c_lanes)));
+using Vector16 = uint16_t __attribute__((vector_size(c_lanes * 2)));
+using Vector32 = uint32_t __attribute__((vector_size(c_lanes * 4)));
+
+//-------------------------------------------------------------------------
+
+template<typename V, typename T>
+[[gnu::always_inline]] inline V
+load(
+    const T* p) noexcept
+{
+    V v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+//-------------------------------------------------------------------------
+
+template<typename V, typename T>
+[[gnu::always_inline]] inline void
+store(
+    T* p,
+    V v) noexcept
+{
+    std::memcpy(p, &v, sizeof(v));
+}
+
+//-------------------------------------------------------------------------
+
+[[gnu::always_inline]] inline Vector16
+expandRed(
+    Vector16 pixels) noexcept
+{
+    const auto r5 = (pixels >> 11) & 0x1F;
+    return (r5 << 3) | (r5 >> 2);
+}
+
+[[gnu::always_inline]] inline Vector16
+expandGreen(
+    Vector16 pixels) noexcept
+{
+    const auto g6 = (pixels >> 5) & 0x3F;
+    return (g6 << 2) | (g6 >> 4);
+}
+
+[[gnu::always_inline]] inline Vector16
+expandBlue(
+    Vector16 pixels) noexcept
+{
+    const auto b5 = pixels & 0x1F;
+    return (b5 << 3) | (b5 >> 2);
+}
+
+//-------------------------------------------------------------------------
+
+template<typename V>
+[[gnu::always_inline]] inline Vector16
+pack(
+    V red,
+    V green,
+    V blue) noexcept
+{
+    const auto r = __builtin_convertvector(red, Vector16);
+    const auto g = __builtin_convertvector(green, Vector16);
+    const auto b = __builtin_convertvector(blue, Vector16);
+
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+}
+
+//-------------------------------------------------------------------------
+
+RGB565_KERNEL_CLONES void
+unpackVector(
+    std::span<const uint16_t> input,
+    std::span<uint8_t> red,
+    std::span<uint8_t> green,
+    std::span<uint8_t> blue)
+{
+    std::size_t i = 0;
+
+    for ( ; (i + c_lanes) <= input.size() ; i += c_lanes)
+    {
+        const auto pixels = load<Vector16>(input.data() + i);
+
+        store(red.data() + i, __builtin_convertvector(expandRed(pixels), Vector8));
+        store(green.data() + i, __builtin_convertvector(expandGreen(pixels), Vector8));
+        store(blue.data() + i, __builtin_convertvector(expandBlue(pixels), Vector8));
+    }
+
+    unpackScalar(input.subspan(i), red.subspan(i), green.subspan(i), blue.subspan(i));
+}
+
+//-------------------------------------------------------------------------
+
+RGB565_KERNEL_CLONES void
+packVector(
+    std::span<const uint8_t> red,
+    std::span<const uint8_t> green,
+    std::span<const uint8_t> blue,
+    std::span<uint16_t> output)
+{
+    std::size_t i = 0;
+
+    for ( ; (i + c_lanes) <= output.size() ; i += c_lanes)
+    {
+        store(output.data() + i, pack(load<Vector8>(red.data() + i),
+                                      load<Vector8>(green.data() + i),
+                                      load<Vector8>(blue.data() + i)));
+    }
+
+    packScalar(red.subspan(i), green.subspan(i), blue.subspan(i), output.subspan(i));
+}
+
+//-------------------------------------------------------------------------
+
+RGB565_KERNEL_CLONES void
+greyVector(
+    std::span<const uint16_t> input,
+    std::span<uint16_t> output)
+{
+    std::size_t i = 0;
+
+    for ( ; (i + c_lanes) <= input.size() ; i += c_lanes)
+    {
+        const auto pixels = load<Vector16>(input.data() + i);
+
+        const auto r = __builtin_convertvector(expandRed(pixels), Vector32);
+        const auto g = __builtin_convertvector(expandGreen(pixels), Vector32);
+        const auto b = __builtin_convertvector(expandBlue(pixels), Vector32);
+
+        const auto sum = (r * 299) + (g * 587) + (b * 114);
+        const auto grey = ((sum >> 3) * 33555) >> 22;
+
+        store(output.data() + i, pack(grey, grey, grey));
+    }
+
+    greyScalar(input.subspan(i), output.subspan(i));
+}
+
+//-------------------------------------------------------------------------
+
+RGB565_KERNEL_CLONES void
+maxChannelVector(
+    std::span<const uint16_t> input,
+    std::span<uint16_t> output)
+{
+    std::size_t i = 0;
+
+    for ( ; (i + c_lanes) <= input.size() ; i += c_lanes)
+    {
+        const auto pixels = load<Vector16>(input.data() + i);
+
+        const auto r = expandRed(pixels);
+        const auto g = expandGreen(pixels);
+        const auto b = expandBlue(pixels);
+
+        const auto rg = (r > g) ? r : g;
+        const auto grey = (rg > b) ? rg : b;
+
+        store(output.data() + i, pack(grey, grey, grey));
+    }
+
+    maxChannelScalar(input.subspan(i), output.subspan(i));
+}
+
+//-------------------------------------------------------------------------
+
+[[gnu::always_inline]] inline Vector32
+scaleChannel(
+    Vector16 channel,
+    Vector32 scale) noexcept
+{
+    const auto max = Vector32{} + 255;
+    const auto scaled = (__builtin_convertvector(channel, Vector32) * scale) >> 16;
+
+    return (scaled < max) ? scaled : max;
+}
+
+//-------------------------------------------------------------------------
+
+RGB565_KERNEL_CLONES void
+scaleVector(
+    std::span<const uint16_t> input,
+    std::span<const uint32_t> scales,
+    std::span<uint16_t> output)
+{
+    std::size_t i = 0;
+
+    for ( ; (i + c_lanes) <= input.size() ; i += c_lanes)
+    {
+        const auto pixels = load<Vector16>(input.data() + i);
+        const auto scale = load<Vector32>(scales.data() + i);
+
+        store(output.data() + i, pack(scaleChannel(expandRed(pixels), scale),
+                                      scaleChannel(expandGreen(pixels), scale),
+                                      scaleChannel(expandBlue(pixels), scale)));
+    }
+
+    scaleScalar(input.subspan(i), scales.subspan(i), output.subspan(i));
+}
+
+//-------------------------------------------------------------------------
+
+[[gnu::always_inline]] inline Vector16
+blendChannel(
+    Vector16 foreground,
+    Vector16 alpha,
+    Vector16 background) noexcept
+{
+    const auto x = (foreground * alpha) + (background * (255 - alpha));
+    return (x + 1 + (x >> 8)) >> 8;
+}
+
+//-------------------------------------------------------------------------
+
+RGB565_KERNEL_CLONES void
+blendVector(
+    uint16_t foreground,
+    uint8_t alpha,
+    std::span<uint16_t> buffer)
+{
+    const auto f = Vector16{} + foreground;
+    const auto fr = expandRed(f);
+    const auto fg = expandGreen(f);
+    const auto fb = expandBlue(f);
+    const auto a = Vector16{} + alpha;
+
+    std::size_t i = 0;
+
+    for ( ; (i + c_lanes) <= buffer.size() ; i += c_lanes)
+    {
+        const auto pixels = load<Vector16>(buffer.data() + i);
+
+        store(buffer.data() + i, pack(blendChannel(fr, a, expandRed(pixels)),
+                                      blendChannel(fg, a, expandGreen(pixels)),
+                                      blendChannel(fb, a, expandBlue(pixels))));
+    }
+
+    blendScalar(foreground, alpha, buffer.subspan(i));
+}
+
+//-------------------------------------------------------------------------
+
+RGB565_KERNEL_CLONES void
+blendCoverageVector(
+    uint16_t foreground,
+    std::span<const uint8_t> coverage,
+    std::span<uint16_t> buffer)
+{
+    const auto f = Vector16{} + foreground;
+    const auto fr = expandRed(f);
+    const auto fg = expandGreen(f);
+    const auto fb = expandBlue(f);
+
+    std::size_t i = 0;
+
+    for ( ; (i + c_lanes) <= buffer.size() ; i += c_lanes)
+    {
+        const auto pixels = load<Vector16>(buffer.data() + i);
+        const auto a = __builtin_convertvector(load<Vector8>(coverage.data() + i), Vector16);
+
+        store(buffer.data() + i, pack(blendChannel(fr, a, expandRed(pixels)),
+                                      blendChannel(fg, a, expandGreen(pixels)),
+                                      blendChannel(fb, a, expandBlue(pixels))));
+    }
+
+    blendCoverageScalar(foreground, coverage.subspan(i), buffer.subspan(i));
+}
+
+//-------------------------------------------------------------------------
+
+// The coverage is interleaved, so each channel's alpha is gathered into a
+// vector of its own.
+
+RGB565_KERNEL_CLONES void
+blendCoverageLcdVector(
+    uint16_t foreground,
+    std::span<const uint8_t> coverage,
+    std::span<uint16_t> buffer)
+{
+    const auto f = Vector16{} + foreground;
+    const auto fr = expandRed(f);
+    const auto fg = expandGreen(f);
+    const auto fb = expandBlue(f);
+
+    std::size_t i = 0;
+
+    for ( ; (i + c_lanes) <= buffer.size() ; i += c_lanes)
+    {
+        const auto* alpha{coverage.data() + (i * 3)};
+        Vector16 ar;
+        Vector16 ag;
+        Vector16 ab;
+
+        for (std::size_t j = 0 ; j < c_lanes ; ++j)
+        {
+            ar[j] = alpha[(j * 3)];
+            ag[j] = alpha[(j * 3) + 1];
+            ab[j] = alpha[(j * 3) + 2];
+        }
+
+        const auto pixels = load<Vector16>(buffer.data() + i);
+
+        store(buffer.data() + i, pack(blendChannel(fr, ar, expandRed(pixels)),
+                                      blendChannel(fg, ag, expandGreen(pixels)),
+                                      blendChannel(fb, ab, expandBlue(pixels))));
+    }
+
+    blendCoverageLcdScalar(foreground, coverage.subspan(i * 3), buffer.subspan(i));
+}
+
+//-------------------------------------------------------------------------
+
+// Fill up to a vector aligned address, then with whole aligned vectors.
+
+RGB565_KERNEL_CLONES void
+fillVector(
+    uint16_t rgb,
+    std::span<uint16_t> buffer)
+{
+    const auto address = reinterpret_cast<uintptr_t>(buffer.data());
+    const auto misaligned = (address % sizeof(Vector16)) / sizeof(uint16_t);
+    const auto head = std::min(buffer.size(),
+                               (misaligned) ? c_lanes - misaligned : 0);
+
+    fillScalar(rgb, buffer.first(head));
+
+    const auto v = Vector16{} + rgb;
+    std::size_t i = head;
+
+    for ( ; (i + c_lanes) <= buffer.size() ; i += c_lanes)
+    {
+        *reinterpret_cast<Vector16*>(buffer.data() + i) = v;
+    }
+
+    fillScalar(rgb, buffer.subspan(i));
+}
+
+//-------------------------------------------------------------------------
+
+#if defined(__SSE2__)
+
+void
+fillStreamVector(
+    uint16_t rgb,
+    std::span<uint16_t> buffer)
+{
+    constexpr std::size_t lanes{sizeof(__m128i) / sizeof(uint16_t)};
+
+    const auto address = reinterpret_cast<uintptr_t>(buffer.data());
+    const auto misaligned = (address % sizeof(__m128i)) / sizeof(uint16_t);
+    const auto head = std::min(buffer.size(),
+                               (misaligned) ? lanes - misaligned : 0);
+
+    fillScalar(rgb, buffer.first(head));
+
+    const auto v = _mm_set1_epi16(static_cast<short>(rgb));
+    std::size_t i = head;
+
+    for ( ; (i + lanes) <= buffer.size() ; i += lanes)
+    {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(buffer.data() + i), v);
+    }
+
+    fillScalar(rgb, buffer.subspan(i));
+    _mm_sfence();
+}
+
+#else
+
+// Without non-temporal stores, aligned wide stores are the next best. The
+// frame buffer is normally mapped write combining, so they do not fill
+// the cache.
+
+void
+fillStreamVector(
+    uint16_t rgb,
+    std::span<uint16_t> buffer)
+{
+    fillVector(rgb, buffer);
+}
+
+#endif
+
+//-------------------------------------------------------------------------
+
+const fb16::RGB565Kernels scalarKernels
+{
+    .name = "scalar",
+    .unpack = unpackScalar,
+    .pack = packScalar,
+    .grey = greyScalar,
+    .maxChannel = maxChannelScalar,
+    .scale = scaleScalar,
+    .blend = blendScalar,
+    .blendCoverage = blendCoverageScalar,
+    .blendCoverageLcd = blendCoverageLcdScalar,
+    .fill = fillScalar,
+    .fillStream = fillScalar
+};
+
+const fb16::RGB565Kernels vectorKernels
+{
+    .name = "vector",
+    .unpack = unpackVector,
+    .pack = packVector,
+    .grey = greyVector,
+    .maxChannel = maxChannelVector,
+    .scale = scaleVector,
+    .blend = blendVector,
+    .blendCoverage = blendCoverageVector,
+    .blendCoverageLcd = blendCoverageLcdVector,
+    .fill = fillVector,
+    .fillStream = fillStreamVector
+};
+
+//-------------------------------------------------------------------------
+
+} // namespace
+
+//=========================================================================
+
+const fb16::RGB565Kernels&
+fb16::rgb565Kernels() noexcept
+{
+    return vectorKernels;
+}
+
+//-------------------------------------------------------------------------
+
+const fb16::RGB565Kernels&
+fb16::rgb565KernelsScalar() noexcept
+{
+    return scalarKernels;
+}
+
@@ -0,0 +1,138 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <cstdint>
+#include <span>
+
+//-------------------------------------------------------------------------
+
+namespace fb16
+{
+
+//-------------------------------------------------------------------------
+
+// Colour kernels that work on whole rows (or buffers) of 565 pixels. The
+// spans passed to a kernel must all be the same length. Every kernel
+// gives exactly the same result as the equivalent RGB8/RGB565 code.
+//
+// rgb565Kernels() returns the fastest set for the processor, selected at
+// run time. rgb565KernelsScalar() returns the plain C++ reference set.
+
+struct RGB565Kernels
+{
+    const char* name;
+
+    // Expand to 8 bit channels (as RGB8).
+
+    void (*unpack)(
+        std::span<const uint16_t> input,
+        std::span<uint8_t> red,
+        std::span<uint8_t> green,
+        std::span<uint8_t> blue);
+
+    // Pack 8 bit channels (as RGB565::rgbTo565).
+
+    void (*pack)(
+        std::span<const uint8_t> red,
+        std::span<const uint8_t> green,
+        std::span<const uint8_t> blue,
+        std::span<uint16_t> output);
+
+    // Luma (as RGB565::toGrey).
+
+    void (*grey)(
+        std::span<const uint16_t> input,
+        std::span<uint16_t> output);
+
+    // Grey level of the largest 8 bit channel.
+
+    void (*maxChannel)(
+        std::span<const uint16_t> input,
+        std::span<uint16_t> output);
+
+    // Multiply each 8 bit channel by a per pixel 16.16 fixed point scale
+    // (less than 256), saturating at 255.
+
+    void (*scale)(
+        std::span<const uint16_t> input,
+        std::span<const uint32_t> scales,
+        std::span<uint16_t> output);
+
+    // Blend foreground over each pixel of buffer (as RGB565::blend).
+
+    void (*blend)(
+        uint16_t foreground,
+        uint8_t alpha,
+        std::span<uint16_t> buffer);
+
+    // Blend foreground over buffer using a per pixel alpha (coverage).
+
+    void (*blendCoverage)(
+        uint16_t foreground,
+        std::span<const uint8_t> coverage,
+        std::span<uint16_t> buffer);
+
+    // Blend foreground over buffer using a separate red, green and blue
+    // coverage for each pixel, three bytes per pixel in that order (LCD
+    // subpixel glyphs).
+
+    void (*blendCoverageLcd)(
+        uint16_t foreground,
+        std::span<const uint8_t> coverage,
+        std::span<uint16_t> buffer);
+
+    // Fill buffer with a colour, using aligned wide stores.
+
+    void (*fill)(
+        uint16_t rgb,
+        std::span<uint16_t> buffer);
+
+    // Fill buffer with a colour, bypassing the cache where the processor
+    // has non-temporal stores. For device memory (a mapped frame buffer)
+    // that is written and not read back.
+
+    void (*fillStream)(
+        uint16_t rgb,
+        std::span<uint16_t> buffer);
+};
+
+//-------------------------------------------------------------------------
+
+[[nodiscard]] const RGB565Kernels& rgb565Kernels() noexcept;
+[[nodiscard]] const RGB565Kernels& rgb565KernelsScalar() noexcept;
+
+//-------------------------------------------------------------------------
+
+} // namespace fb16
+
+//-------------------------------------------------------------------------
+
@@ -0,0 +1,249 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "spriteAtlas565.h"
+
+//=========================================================================
+
+fb16::SpriteAtlas565::SpriteAtlas565(
+    int width)
+:
+    m_width{width},
+    m_height{0},
+    m_shelves{},
+    m_sprites{},
+    m_buffer{}
+{
+    if (width < 1)
+    {
+        throw std::invalid_argument("sprite atlas width must be at least one pixel");
+    }
+}
+
+//-------------------------------------------------------------------------
+
+fb16::SpriteAtlas565::SpriteId
+fb16::SpriteAtlas565::add(
+    const Interface565Base& image)
+{
+    const auto d = image.getDimensions();
+    const auto p = place(d);
+
+    for (auto j = 0 ; j < d.height() ; ++j)
+    {
+        const auto row = image.getRow(j);
+        const auto ost = ((p.y() + j) * m_width) + p.x();
+
+        std::ranges::copy(row, m_buffer.begin() + ost);
+    }
+
+    m_sprites.emplace_back(p, d);
+    return m_sprites.size() - 1;
+}
+
+//-------------------------------------------------------------------------
+
+fb16::SpriteAtlas565::SpriteId
+fb16::SpriteAtlas565::add(
+    Dimensions565 d,
+    std::span<const uint16_t> pixels)
+{
+    if (pixels.size() < static_cast<std::size_t>(d.width() * d.height()))
+    {
+        throw std::invalid_argument("too few pixels for sprite dimensions");
+    }
+
+    const auto p = place(d);
+
+    for (auto j = 0 ; j < d.height() ; ++j)
+    {
+        const auto row = pixels.subspan(j * d.width(), d.width());
+        const auto ost = ((p.y() + j) * m_width) + p.x();
+
+        std::ranges::copy(row, m_buffer.begin() + ost);
+    }
+
+    m_sprites.emplace_back(p, d);
+    return m_sprites.size() - 1;
+}
+
+//-------------------------------------------------------------------------
+
+const fb16::Rectangle565&
+fb16::SpriteAtlas565::getRectangle(
+    SpriteId id) const
+{
+    return m_sprites.at(id);
+}
+
+//-------------------------------------------------------------------------
+
+bool
+fb16::SpriteAtlas565::drawSprite(
+    Interface565Base& target,
+    Point565 p,
+    SpriteId id,
+    int zoom) const
+{
+    const Placement sprite{id, p};
+
+    return drawSprites(target, std::span{&sprite, 1}, zoom);
+}
+
+//-------------------------------------------------------------------------
+
+bool
+fb16::SpriteAtlas565::drawSprites(
+    Interface565Base& target,
+    std::span<const Placement> sprites,
+    int zoom) const
+{
+    if (zoom < 1)
+    {
+        throw std::invalid_argument("sprite zoom must be at least one");
+    }
+
+    // everything that does not change from one sprite to the next is
+    // looked up once for the whole batch
+
+    const auto clip = target.getClip();
+    const auto stride = target.getLineLengthPixels();
+    auto buffer = target.getBuffer();
+
+    bool drawn{false};
+
+    for (const auto& [id, p] : sprites)
+    {
+        const auto& source = getRectangle(id);
+        const Dimensions565 zoomed{source.width() * zoom, source.height() * zoom};
+        const auto visible = clip.intersection(Rectangle565{p, zoomed});
+
+        if (visible.empty())
+        {
+            continue;
+        }
+
+        const auto width = visible.width();
+        auto to = buffer.begin() + target.offset(visible.topLeft());
+
+        if (zoom == 1)
+        {
+            const auto x = source.left() + visible.left() - p.x();
+            const auto y = source.top() + visible.top() - p.y();
+
+            auto from = m_buffer.begin() + (y * m_width) + x;
+
+            for (auto j = 0 ; j < visible.height() ; ++j)
+            {
+                std::copy_n(from, width, to);
+                from += m_width;
+                to += stride;
+            }
+        }
+        else
+        {
+            // build each source row once, zoomed, then copy it down for
+            // the rows that repeat it
+
+            const auto dx = visible.left() - p.x();
+
+            for (auto j = 0 ; j < visible.height() ; ++j)
+            {
+                const auto dy = visible.top() + j - p.y();
+
+                if ((j > 0) and ((dy % zoom) != 0))
+                {
+                    std::copy_n(to - stride, width, to);
+                }
+                else
+                {
+                    const auto y = source.top() + (dy / zoom);
+                    auto from = m_buffer.begin() + (y * m_width) +
+                                source.left() + (dx / zoom);
+                    auto run = zoom - (dx % zoom);
+
+                    for (auto i = 0 ; i < width ; i += run, run = zoom)
+                    {
+                        std::fill_n(to + i, std::min(run, width - i), *from++);
+                    }
+                }
+
+                to += stride;
+            }
+        }
+
+        drawn = true;
+    }
+
+    return drawn;
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Point565
+fb16::SpriteAtlas565::place(
+    Dimensions565 d)
+{
+    if (d.width() > m_width)
+    {
+        throw std::invalid_argument("sprite is wider than the atlas");
+    }
+
+    if ((d.width() < 1) or (d.height() < 1))
+    {
+        return Point565{0, 0};
+    }
+
+    Shelf* best{nullptr};
+
+    for (auto& shelf : m_shelves)
+    {
+        if ((shelf.m_height >= d.height()) and
+            ((m_width - shelf.m_used) >= d.width()) and
+            ((best == nullptr) or (shelf.m_height < best->m_height)))
+        {
+            best = &shelf;
+        }
+    }
+
+    if (best == nullptr)
+    {
+        best = &m_shelves.emplace_back(m_height, d.height(), 0);
+        m_height += d.height();
+        m_buffer.resize(static_cast<std::size_t>(m_width) * m_height);
+    }
+
+    const Point565 p{best->m_used, best->m_top};
+    best->m_used += d.width();
+
+    return p;
+}
+
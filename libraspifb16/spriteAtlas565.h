@@ -0,0 +1,126 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "dimensions.h"
+#include "interface565.h"
+#include "interface565Base.h"
+#include "point.h"
+#include "rectangle.h"
+
+//-------------------------------------------------------------------------
+
+namespace fb16
+{
+
+//-------------------------------------------------------------------------
+
+// Many sprites, of any size, packed into one 565 buffer. Sprites are
+// placed on shelves as they are added: each goes on the shortest shelf
+// that is tall enough and has room left, or on a new shelf added below
+// the others. The buffer is a fixed width and grows downwards. Unlike
+// Image565Frames, whose frames are all one size in a buffer sized when it
+// is made, sprites of any size can be added at any time.
+//
+// drawSprites() draws a whole batch of sprites (for example every tile of
+// a board) in one call, copying rows straight from the atlas.
+
+class SpriteAtlas565
+{
+public:
+
+    using SpriteId = std::size_t;
+
+    struct Placement
+    {
+        SpriteId m_id;
+        Point565 m_position;
+    };
+
+    static constexpr int c_defaultWidth{256};
+
+    explicit SpriteAtlas565(int width = c_defaultWidth);
+
+    // Sprites wider than the atlas throw std::invalid_argument.
+
+    SpriteId add(const Interface565Base& image);
+    SpriteId add(Dimensions565 d, std::span<const uint16_t> pixels);
+
+    [[nodiscard]] std::size_t size() const noexcept { return m_sprites.size(); }
+    [[nodiscard]] bool empty() const noexcept { return m_sprites.empty(); }
+
+    // Where a sprite is in the atlas. Throws std::out_of_range for an
+    // unknown id.
+
+    [[nodiscard]] const Rectangle565& getRectangle(SpriteId id) const;
+    [[nodiscard]] Dimensions565 getDimensions() const noexcept { return {m_width, m_height}; }
+
+    // Draw one sprite, or many in the order given, each pixel repeated
+    // zoom times across and down. Sprites are clipped to the current clip
+    // of target. Return false if nothing was drawn.
+
+    bool drawSprite(Interface565Base& target, Point565 p, SpriteId id, int zoom = 1) const;
+    bool
+    drawSprites(
+        Interface565Base& target,
+        std::span<const Placement> sprites,
+        int zoom = 1) const;
+
+private:
+
+    struct Shelf
+    {
+        int m_top;
+        int m_height;
+        int m_used;
+    };
+
+    Point565 place(Dimensions565 d);
+
+    int m_width;
+    int m_height;
+
+    std::vector<Shelf> m_shelves;
+    std::vector<Rectangle565> m_sprites;
+    std::vector<uint16_t> m_buffer;
+};
+
+//-------------------------------------------------------------------------
+
+} // namespace fb16
+
+//-------------------------------------------------------------------------
+
@@ -0,0 +1,301 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "textLayout565.h"
+#include "unicode.h"
+
+//=========================================================================
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+constexpr std::string_view c_ellipsis{"..."};
+
+//-------------------------------------------------------------------------
+
+int
+stringWidth(
+    fb16::Interface565Font& font,
+    std::string_view text)
+{
+    return font.getStringDimensions(text).width();
+}
+
+//-------------------------------------------------------------------------
+
+bool
+fits(
+    fb16::Interface565Font& font,
+    std::string_view text,
+    int width)
+{
+    return stringWidth(font, text) <= width;
+}
+
+//-------------------------------------------------------------------------
+
+// The last code point of text, which must not be empty.
+
+std::string_view
+lastCodePoint(
+    std::string_view text)
+{
+    auto start = text.size() - 1;
+
+    while ((start > 0) and ((static_cast<uint8_t>(text[start]) & 0xC0) == 0x80))
+    {
+        --start;
+    }
+
+    return text.substr(start);
+}
+
+//-------------------------------------------------------------------------
+
+// The length in bytes of the longest prefix of text, ending between code
+// points, that fits in width with suffix after it. Prefixes are measured
+// by binary search, so a long line takes only a few measurements.
+
+std::size_t
+fittingPrefix(
+    fb16::Interface565Font& font,
+    std::string_view text,
+    std::string_view suffix,
+    int width)
+{
+    std::vector<std::size_t> ends;
+
+    for (std::size_t i = 0 ; i < text.size() ; )
+    {
+        static_cast<void>(fb16::decodeUtf8(text, i));
+        ends.push_back(i);
+    }
+
+    auto prefixFits = [&](std::size_t end)
+    {
+        std::string candidate{text.substr(0, end)};
+        candidate += suffix;
+        return fits(font, candidate, width);
+    };
+
+    // ends[first, last) are the prefixes not yet known to fit or not
+
+    std::size_t first = 0;
+    std::size_t last = ends.size();
+
+    while (first < last)
+    {
+        const auto middle = first + ((last - first) / 2);
+
+        if (prefixFits(ends[middle]))
+        {
+            first = middle + 1;
+        }
+        else
+        {
+            last = middle;
+        }
+    }
+
+    return (first == 0) ? 0 : ends[first - 1];
+}
+
+//-------------------------------------------------------------------------
+
+void
+wrapLine(
+    fb16::Interface565Font& font,
+    std::string_view text,
+    int width,
+    std::string& wrapped)
+{
+    std::string line;
+    int lineWidth{0};
+
+    auto endLine = [&]
+    {
+        wrapped += line;
+        wrapped += '\n';
+        line.clear();
+    };
+
+    for (std::size_t start = 0 ; start < text.size() ; )
+    {
+        const auto space = std::min(text.find(' ', start), text.size());
+        auto word = text.substr(start, space - start);
+        start = space + 1;
+
+        if (word.empty())
+        {
+            continue;
+        }
+
+        if (not line.empty())
+        {
+            // a font lays text out by advances and kerning, so the line
+            // grows by the width of its last character, a space and the
+            // word, less that of the last character. Only the join has to
+            // be measured, not the whole line again.
+
+            const auto last = lastCodePoint(line);
+            std::string join{last};
+            join += ' ';
+            join += word;
+
+            const auto joinedWidth = lineWidth +
+                                     stringWidth(font, join) -
+                                     stringWidth(font, last);
+
+            if (joinedWidth <= width)
+            {
+                line += ' ';
+                line += word;
+                lineWidth = joinedWidth;
+                continue;
+            }
+
+            endLine();
+        }
+
+        auto wordWidth = stringWidth(font, word);
+
+        while (wordWidth > width)
+        {
+            // always take at least one character, or a word would never
+            // get shorter
+
+            auto length = fittingPrefix(font, word, {}, width);
+
+            if (length == 0)
+            {
+                std::size_t next = 0;
+                static_cast<void>(fb16::decodeUtf8(word, next));
+                length = next;
+            }
+
+            if (length == word.size())
+            {
+                break;
+            }
+
+            line = word.substr(0, length);
+            endLine();
+            word.remove_prefix(length);
+            wordWidth = stringWidth(font, word);
+        }
+
+        line = word;
+        lineWidth = wordWidth;
+    }
+
+    wrapped += line;
+}
+
+//-------------------------------------------------------------------------
+
+} // namespace
+
+//=========================================================================
+
+std::string
+fb16::wrapText(
+    Interface565Font& font,
+    std::string_view text,
+    int width)
+{
+    std::string wrapped;
+
+    for (std::size_t start = 0 ; ; )
+    {
+        const auto newline = std::min(text.find('\n', start), text.size());
+
+        wrapLine(font, text.substr(start, newline - start), width, wrapped);
+
+        if (newline == text.size())
+        {
+            break;
+        }
+
+        wrapped += '\n';
+        start = newline + 1;
+    }
+
+    return wrapped;
+}
+
+//-------------------------------------------------------------------------
+
+std::string
+fb16::elideText(
+    Interface565Font& font,
+    std::string_view text,
+    int width)
+{
+    std::string elided;
+
+    for (std::size_t start = 0 ; ; )
+    {
+        const auto newline = std::min(text.find('\n', start), text.size());
+        const auto line = text.substr(start, newline - start);
+
+        if (fits(font, line, width))
+        {
+            elided += line;
+        }
+        else if (fits(font, c_ellipsis, width))
+        {
+            auto prefix = line.substr(0, fittingPrefix(font, line, c_ellipsis, width));
+
+            while (prefix.ends_with(' '))
+            {
+                prefix.remove_suffix(1);
+            }
+
+            elided += prefix;
+            elided += c_ellipsis;
+        }
+
+        if (newline == text.size())
+        {
+            break;
+        }
+
+        elided += '\n';
+        start = newline + 1;
+    }
+
+    return elided;
+}
+
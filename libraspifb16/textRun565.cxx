@@ -0,0 +1,212 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <algorithm>
+
+#include "rgb565Kernels.h"
+#include "textRun565.h"
+
+//=========================================================================
+
+fb16::TextRun565::TextRun565(
+    Interface565Font& font,
+    std::string_view text,
+    const RGB565& rgb)
+{
+    set(font, text, rgb);
+}
+
+//-------------------------------------------------------------------------
+
+bool
+fb16::TextRun565::set(
+    Interface565Font& font,
+    std::string_view text,
+    const RGB565& rgb)
+{
+    // a revision identifies both the font and its size, style and
+    // rendering, and the coverage does not depend on the colour
+
+    const auto fontRevision = font.getRevision();
+
+    m_rgb = rgb;
+
+    if ((m_fontRevision == fontRevision) and (m_text == text))
+    {
+        return false;
+    }
+
+    m_fontRevision = fontRevision;
+    m_text = text;
+    m_bounds = Rectangle565{};
+
+    m_spans.clear();
+    m_coverage.clear();
+
+    m_end = font.drawCoverage(Point565{0, 0},
+                              text,
+                              [this](Point565 p, std::span<const uint8_t> coverage, bool lcd)
+                              {
+                                  addCoverage(p, coverage, lcd);
+                              });
+
+    return true;
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Point565
+fb16::TextRun565::draw(
+    Interface565Base& target,
+    Point565 p) const
+{
+    const auto& kernels = rgb565Kernels();
+    const auto fill = (target.deviceMemory()) ? kernels.fillStream : kernels.fill;
+
+    const auto clip = target.getClip();
+    auto buffer = target.getBuffer();
+    const auto rgb = m_rgb.get565();
+
+    for (const auto& span : m_spans)
+    {
+        const auto y = p.y() + span.m_y;
+
+        if ((y < clip.top()) or (y > clip.bottom()))
+        {
+            continue;
+        }
+
+        const auto x1 = std::max(p.x() + span.m_x, clip.left());
+        const auto x2 = std::min(p.x() + span.m_x + span.m_length - 1, clip.right());
+
+        if (x1 > x2)
+        {
+            continue;
+        }
+
+        const auto length = static_cast<std::size_t>(x2 - x1 + 1);
+        auto pixels = buffer.subspan(target.offset(Point565{x1, y}), length);
+
+        if (span.m_solid)
+        {
+            fill(rgb, pixels);
+        }
+        else
+        {
+            const auto blend = (span.m_lcd) ? kernels.blendCoverageLcd
+                                            : kernels.blendCoverage;
+            const std::size_t channels = (span.m_lcd) ? 3 : 1;
+            const auto skip = static_cast<std::size_t>(x1 - (p.x() + span.m_x));
+
+            blend(rgb,
+                  std::span{m_coverage}.subspan(span.m_offset + (skip * channels),
+                                                length * channels),
+                  pixels);
+        }
+    }
+
+    return Point565{p.x() + m_end.x(), p.y() + m_end.y()};
+}
+
+//-------------------------------------------------------------------------
+
+void
+fb16::TextRun565::addCoverage(
+    Point565 p,
+    std::span<const uint8_t> coverage,
+    bool lcd)
+{
+    // split the row into runs of covered pixels, each either solid or
+    // partly covered, leaving out the pixels with no coverage at all. An
+    // LCD pixel is solid, or not covered, only if all three channels are.
+
+    const std::size_t channels = (lcd) ? 3 : 1;
+    const auto size = static_cast<int>(coverage.size() / channels);
+
+    auto pixelCoverage = [&](int i)
+    {
+        return coverage.subspan(i * channels, channels);
+    };
+
+    auto covered = [&](int i)
+    {
+        return std::ranges::any_of(pixelCoverage(i), [](uint8_t a) { return a != 0; });
+    };
+
+    auto solid = [&](int i)
+    {
+        return std::ranges::all_of(pixelCoverage(i), [](uint8_t a) { return a == 255; });
+    };
+
+    for (auto i = 0 ; i < size ; )
+    {
+        if (not covered(i))
+        {
+            ++i;
+            continue;
+        }
+
+        const bool isSolid = solid(i);
+        auto end = i + 1;
+
+        while ((end < size) and covered(end) and (solid(end) == isSolid))
+        {
+            ++end;
+        }
+
+        Span span{p.x() + i, p.y(), end - i, isSolid, lcd, m_coverage.size()};
+
+        if (not isSolid)
+        {
+            m_coverage.insert(m_coverage.end(),
+                              coverage.begin() + (i * channels),
+                              coverage.begin() + (end * channels));
+        }
+
+        m_spans.push_back(span);
+
+        const Rectangle565 area{Point565{span.m_x, span.m_y},
+                                Dimensions565{span.m_length, 1}};
+
+        if (m_bounds.empty())
+        {
+            m_bounds = area;
+        }
+        else
+        {
+            m_bounds = Rectangle565{
+                Point565{std::min(m_bounds.left(), area.left()),
+                         std::min(m_bounds.top(), area.top())},
+                Point565{std::max(m_bounds.right(), area.right()),
+                         std::max(m_bounds.bottom(), area.bottom())}};
+        }
+
+        i = end;
+    }
+}
+
@@ -0,0 +1,129 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "dimensions.h"
+#include "interface565.h"
+#include "interface565Base.h"
+#include "interface565Font.h"
+#include "point.h"
+#include "rectangle.h"
+#include "rgb565.h"
+
+//-------------------------------------------------------------------------
+
+namespace fb16
+{
+
+//-------------------------------------------------------------------------
+
+// A string laid out and rasterised once, for a font and colour, as a list
+// of spans of coverage. draw() blends the spans straight into a target,
+// so a label drawn every frame does not go back to the font. set() only
+// rasterises the text again when it or the font changes, including a
+// change to the font's size, style or LCD rendering. A new colour is
+// just used for the next draw().
+//
+// Drawing a run gives exactly the same pixels as drawString(), LCD
+// subpixel glyphs included.
+
+class TextRun565
+{
+public:
+
+    TextRun565() = default;
+
+    TextRun565(
+        Interface565Font& font,
+        std::string_view text,
+        const RGB565& rgb);
+
+    // Return true if the text was rasterised again.
+
+    bool
+    set(
+        Interface565Font& font,
+        std::string_view text,
+        const RGB565& rgb);
+
+    [[nodiscard]] const std::string& getText() const noexcept { return m_text; }
+    [[nodiscard]] RGB565 getRGB() const noexcept { return m_rgb; }
+    [[nodiscard]] bool empty() const noexcept { return m_spans.empty(); }
+
+    // The pixels covered, relative to the point the run is drawn at.
+
+    [[nodiscard]] const Rectangle565& getBounds() const noexcept { return m_bounds; }
+
+    // Draw the run as drawString() would at p, clipped to the current
+    // clip of target. Returns the position drawString() would.
+
+    Point565 draw(Interface565Base& target, Point565 p) const;
+
+private:
+
+    // A run of pixels on one row, either solid or blended with coverage
+    // starting at m_offset, three bytes a pixel if m_lcd is set.
+
+    struct Span
+    {
+        int m_x;
+        int m_y;
+        int m_length;
+        bool m_solid;
+        bool m_lcd;
+        std::size_t m_offset;
+    };
+
+    void addCoverage(Point565 p, std::span<const uint8_t> coverage, bool lcd);
+
+    uint64_t m_fontRevision{0};
+    std::string m_text{};
+    RGB565 m_rgb{0};
+    Point565 m_end{0, 0};
+    Rectangle565 m_bounds{};
+
+    std::vector<Span> m_spans{};
+    std::vector<uint8_t> m_coverage{};
+};
+
+//-------------------------------------------------------------------------
+
+} // namespace fb16
+
+//-------------------------------------------------------------------------
+
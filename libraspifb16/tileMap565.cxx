@@ -0,0 +1,278 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "tileMap565.h"
+
+//=========================================================================
+
+fb16::TileMap565::TileMap565(
+    Dimensions565 tileSize,
+    Dimensions565 grid,
+    SpriteId fill)
+:
+    m_tileSize{tileSize},
+    m_grid{grid},
+    m_origin{0, 0},
+    m_zoom{1},
+    m_reportDamage{false},
+    m_cells{},
+    m_dirty{},
+    m_dirtyCount{0},
+    m_placements{},
+    m_damage{}
+{
+    if ((tileSize.width() < 1) or (tileSize.height() < 1))
+    {
+        throw std::invalid_argument("tile map tiles must be at least one pixel");
+    }
+
+    if ((grid.width() < 1) or (grid.height() < 1))
+    {
+        throw std::invalid_argument("tile map grid must be at least one cell");
+    }
+
+    const auto cells = static_cast<std::size_t>(grid.width()) * grid.height();
+
+    m_cells.assign(cells, fill);
+    m_dirty.assign(cells, 0);
+    m_placements.reserve(cells);
+
+    invalidate();
+}
+
+//-------------------------------------------------------------------------
+
+fb16::TileMap565::SpriteId
+fb16::TileMap565::getTile(
+    Point565 cell) const
+{
+    return m_cells[index(cell)];
+}
+
+//-------------------------------------------------------------------------
+
+void
+fb16::TileMap565::setTile(
+    Point565 cell,
+    SpriteId id)
+{
+    const auto i = index(cell);
+
+    if (m_cells[i] != id)
+    {
+        m_cells[i] = id;
+        invalidate(cell);
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+fb16::TileMap565::setOrigin(
+    Point565 origin) noexcept
+{
+    if (origin != m_origin)
+    {
+        m_origin = origin;
+        invalidate();
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+fb16::TileMap565::setZoom(
+    int zoom)
+{
+    if (zoom < 1)
+    {
+        throw std::invalid_argument("tile map zoom must be at least one");
+    }
+
+    if (zoom != m_zoom)
+    {
+        m_zoom = zoom;
+        invalidate();
+    }
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Rectangle565
+fb16::TileMap565::getCellRectangle(
+    Point565 cell) const noexcept
+{
+    const auto width = m_tileSize.width() * m_zoom;
+    const auto height = m_tileSize.height() * m_zoom;
+
+    return Rectangle565{Point565{m_origin.x() + (cell.x() * width),
+                                 m_origin.y() + (cell.y() * height)},
+                        Dimensions565{width, height}};
+}
+
+//-------------------------------------------------------------------------
+
+fb16::Rectangle565
+fb16::TileMap565::getRectangle() const noexcept
+{
+    return Rectangle565{m_origin,
+                        Dimensions565{m_grid.width() * m_tileSize.width() * m_zoom,
+                                      m_grid.height() * m_tileSize.height() * m_zoom}};
+}
+
+//-------------------------------------------------------------------------
+
+void
+fb16::TileMap565::invalidate() noexcept
+{
+    std::ranges::fill(m_dirty, 1);
+    m_dirtyCount = m_dirty.size();
+}
+
+//-------------------------------------------------------------------------
+
+void
+fb16::TileMap565::invalidate(
+    Point565 cell)
+{
+    auto& dirty = m_dirty[index(cell)];
+
+    if (not dirty)
+    {
+        dirty = 1;
+        ++m_dirtyCount;
+    }
+}
+
+//-------------------------------------------------------------------------
+
+bool
+fb16::TileMap565::draw(
+    Interface565Base& target,
+    const SpriteAtlas565& atlas)
+{
+    if (m_dirtyCount == 0)
+    {
+        return false;
+    }
+
+    m_placements.clear();
+    m_damage.clear();
+
+    // each run of dirty cells along a row is one damaged rectangle, which
+    // is merged with a run of the same cells in the row above
+
+    for (auto j = 0 ; j < m_grid.height() ; ++j)
+    {
+        auto runStart = -1;
+
+        for (auto i = 0 ; i <= m_grid.width() ; ++i)
+        {
+            const Point565 cell{i, j};
+            const bool dirty = (i < m_grid.width()) and m_dirty[index(cell)];
+
+            if (dirty)
+            {
+                m_placements.push_back({m_cells[index(cell)],
+                                        getCellRectangle(cell).topLeft()});
+
+                if (runStart < 0)
+                {
+                    runStart = i;
+                }
+            }
+            else if (runStart >= 0)
+            {
+                const auto first = getCellRectangle(Point565{runStart, j});
+                const Dimensions565 d{first.width() * (i - runStart), first.height()};
+
+                addDamage(Rectangle565{first.topLeft(), d});
+                runStart = -1;
+            }
+        }
+    }
+
+    const bool drawn = atlas.drawSprites(target, m_placements, m_zoom);
+
+    if (m_reportDamage)
+    {
+        const auto clip = target.getClip();
+
+        for (const auto& damage : m_damage)
+        {
+            target.addDamage(clip.intersection(damage));
+        }
+    }
+
+    std::ranges::fill(m_dirty, 0);
+    m_dirtyCount = 0;
+
+    return drawn;
+}
+
+//-------------------------------------------------------------------------
+
+std::size_t
+fb16::TileMap565::index(
+    Point565 cell) const
+{
+    if (not Rectangle565{Point565{0, 0}, m_grid}.contains(cell))
+    {
+        throw std::out_of_range("tile map cell is outside of the grid");
+    }
+
+    return static_cast<std::size_t>(cell.x()) + (cell.y() * m_grid.width());
+}
+
+//-------------------------------------------------------------------------
+
+void
+fb16::TileMap565::addDamage(
+    const Rectangle565& run)
+{
+    auto above = std::ranges::find_if(m_damage, [&run](const auto& damage)
+    {
+        return (damage.left() == run.left()) and
+               (damage.width() == run.width()) and
+               ((damage.bottom() + 1) == run.top());
+    });
+
+    if (above == m_damage.end())
+    {
+        m_damage.push_back(run);
+    }
+    else
+    {
+        *above = Rectangle565{above->topLeft(),
+                              Dimensions565{run.width(), above->height() + run.height()}};
+    }
+}
+
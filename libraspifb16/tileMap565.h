@@ -0,0 +1,135 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <cstdint>
+#include <vector>
+
+#include "dimensions.h"
+#include "interface565.h"
+#include "interface565Base.h"
+#include "point.h"
+#include "rectangle.h"
+#include "spriteAtlas565.h"
+
+//-------------------------------------------------------------------------
+
+namespace fb16
+{
+
+//-------------------------------------------------------------------------
+
+// A grid of tiles for board games, each cell holding the id of a sprite
+// in a SpriteAtlas565. Changing a cell marks it dirty, and draw() only
+// draws the dirty cells. It can also report the area they cover as damage
+// to the target, so that update() only has to copy that part of the
+// screen. As that switches update() to partial updates for everything on
+// the screen, it is off unless the program asks for it.
+//
+// The grid is drawn with its top left corner at the origin, each tile
+// zoomed by a whole number. Moving or zooming the grid marks every cell
+// dirty, as does invalidate().
+
+class TileMap565
+{
+public:
+
+    using SpriteId = SpriteAtlas565::SpriteId;
+
+    // Throws std::invalid_argument if the tile size or grid is empty.
+
+    TileMap565(
+        Dimensions565 tileSize,
+        Dimensions565 grid,
+        SpriteId fill = 0);
+
+    [[nodiscard]] Dimensions565 getGrid() const noexcept { return m_grid; }
+    [[nodiscard]] Dimensions565 getTileSize() const noexcept { return m_tileSize; }
+
+    // Cells outside of the grid throw std::out_of_range.
+
+    [[nodiscard]] SpriteId getTile(Point565 cell) const;
+    void setTile(Point565 cell, SpriteId id);
+
+    [[nodiscard]] Point565 getOrigin() const noexcept { return m_origin; }
+    void setOrigin(Point565 origin) noexcept;
+
+    // Throws std::invalid_argument if zoom is less than one.
+
+    [[nodiscard]] int getZoom() const noexcept { return m_zoom; }
+    void setZoom(int zoom);
+
+    // The area of the target covered by a cell, or by the whole grid.
+
+    [[nodiscard]] Rectangle565 getCellRectangle(Point565 cell) const noexcept;
+    [[nodiscard]] Rectangle565 getRectangle() const noexcept;
+
+    void invalidate() noexcept;
+    void invalidate(Point565 cell);
+
+    [[nodiscard]] bool dirty() const noexcept { return m_dirtyCount > 0; }
+
+    // When set, draw() reports the cells it draws with addDamage(). The
+    // program must then report anything else it draws too.
+
+    [[nodiscard]] bool getReportDamage() const noexcept { return m_reportDamage; }
+    void setReportDamage(bool reportDamage) noexcept { m_reportDamage = reportDamage; }
+
+    // Draw the dirty cells, clipped to the current clip of target, and
+    // mark them clean. Return false if there was nothing to draw.
+
+    bool draw(Interface565Base& target, const SpriteAtlas565& atlas);
+
+private:
+
+    [[nodiscard]] std::size_t index(Point565 cell) const;
+    void addDamage(const Rectangle565& run);
+
+    Dimensions565 m_tileSize;
+    Dimensions565 m_grid;
+    Point565 m_origin;
+    int m_zoom;
+    bool m_reportDamage;
+
+    std::vector<SpriteId> m_cells;
+    std::vector<uint8_t> m_dirty;
+    std::size_t m_dirtyCount;
+
+    std::vector<SpriteAtlas565::Placement> m_placements;
+    std::vector<Rectangle565> m_damage;
+};
+
+//-------------------------------------------------------------------------
+
+} // namespace fb16
+
+//-------------------------------------------------------------------------
+
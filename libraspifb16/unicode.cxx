@@ -0,0 +1,182 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+#include "unicode.h"
+
+//=========================================================================
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+// The code points of the top half of code page 437, 0x80 to 0xFF.
+
+constexpr std::array<char16_t, 128> c_codePage437
+{
+    0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7,
+    0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x00EC, 0x00C4, 0x00C5,
+    0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00F2, 0x00FB, 0x00F9,
+    0x00FF, 0x00D6, 0x00DC, 0x00A2, 0x00A3, 0x00A5, 0x20A7, 0x0192,
+    0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA,
+    0x00BF, 0x2310, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB,
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556,
+    0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510,
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F,
+    0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567,
+    0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B,
+    0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580,
+    0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4,
+    0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229,
+    0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248,
+    0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0
+};
+
+//-------------------------------------------------------------------------
+
+// The same table as (code point, character) pairs sorted by code point,
+// for looking up.
+
+constexpr auto c_fromUnicode = []
+{
+    std::array<std::pair<char16_t, uint8_t>, c_codePage437.size()> table{};
+
+    for (std::size_t i = 0 ; i < table.size() ; ++i)
+    {
+        table[i] = {c_codePage437[i], static_cast<uint8_t>(0x80 + i)};
+    }
+
+    std::ranges::sort(table);
+
+    return table;
+}();
+
+//-------------------------------------------------------------------------
+
+} // namespace
+
+//=========================================================================
+
+char32_t
+fb16::decodeUtf8(
+    std::string_view sv,
+    std::size_t& position) noexcept
+{
+    const auto lead = static_cast<uint8_t>(sv[position]);
+    ++position;
+
+    if (lead < 0x80)
+    {
+        return lead;
+    }
+
+    int length{};
+    char32_t c{};
+    char32_t minimum{};
+
+    if ((lead & 0xE0) == 0xC0)
+    {
+        length = 1;
+        c = lead & 0x1F;
+        minimum = 0x80;
+    }
+    else if ((lead & 0xF0) == 0xE0)
+    {
+        length = 2;
+        c = lead & 0x0F;
+        minimum = 0x800;
+    }
+    else if ((lead & 0xF8) == 0xF0)
+    {
+        length = 3;
+        c = lead & 0x07;
+        minimum = 0x10000;
+    }
+    else
+    {
+        return lead;
+    }
+
+    if (position + length > sv.size())
+    {
+        return lead;
+    }
+
+    for (int i = 0 ; i < length ; ++i)
+    {
+        const auto next = static_cast<uint8_t>(sv[position + i]);
+
+        if ((next & 0xC0) != 0x80)
+        {
+            return lead;
+        }
+
+        c = (c << 6) | (next & 0x3F);
+    }
+
+    if ((c < minimum) or (c > 0x10FFFF) or ((c >= 0xD800) and (c <= 0xDFFF)))
+    {
+        return lead;
+    }
+
+    position += length;
+
+    return c;
+}
+
+//-------------------------------------------------------------------------
+
+std::optional<uint8_t>
+fb16::toCodePage437(
+    char32_t c) noexcept
+{
+    if (c < 0x80)
+    {
+        return static_cast<uint8_t>(c);
+    }
+
+    const auto it = std::ranges::lower_bound(c_fromUnicode,
+                                             c,
+                                             {},
+                                             [](const auto& entry) -> char32_t
+                                             {
+                                                 return entry.first;
+                                             });
+
+    if ((it != c_fromUnicode.end()) and (it->first == c))
+    {
+        return it->second;
+    }
+
+    return {};
+}
+
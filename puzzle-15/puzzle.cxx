@@ -50,28 +50,23 @@ Puzzle::Puzzle(bool fitToScreen)
         0x0D, 0x0E, 0x0F, 0x00
     },
     m_fitToScreen{fitToScreen},
-    m_image{ fb16::Dimensions565{c_tileWidth * 4, c_tileHeight * 4}},
-    m_tileBuffers(
-        {
-            { c_tileDimensions, c_piece0 },
-            { c_tileDimensions, c_piece1 },
-            { c_tileDimensions, c_piece2 },
-            { c_tileDimensions, c_piece3 },
-            { c_tileDimensions, c_piece4 },
-            { c_tileDimensions, c_piece5 },
-            { c_tileDimensions, c_piece6 },
-            { c_tileDimensions, c_piece7 },
-            { c_tileDimensions, c_piece8 },
-            { c_tileDimensions, c_piece9 },
-            { c_tileDimensions, c_piece10 },
-            { c_tileDimensions, c_piece11 },
-            { c_tileDimensions, c_piece12 },
-            { c_tileDimensions, c_piece13 },
-            { c_tileDimensions, c_piece14 },
-            { c_tileDimensions, c_piece15 },
-        }),
-    m_tileSolved{ c_tileDimensions, c_smiley }
+    m_tiles(),
+    m_tileMap{c_tileDimensions, fb16::Dimensions565{c_puzzleWidth, c_puzzleHeight}}
 {
+    for (const auto* piece : {
+            &c_piece0, &c_piece1, &c_piece2, &c_piece3,
+            &c_piece4, &c_piece5, &c_piece6, &c_piece7,
+            &c_piece8, &c_piece9, &c_piece10, &c_piece11,
+            &c_piece12, &c_piece13, &c_piece14, &c_piece15,
+            &c_smiley })
+    {
+        m_tiles.add(c_tileDimensions, *piece);
+    }
+
+    // The board is all that is drawn. The rest of the screen is copied
+    // out by the first update, as the screen has been cleared.
+
+    m_tileMap.setReportDamage(true);
 }
 
 //-------------------------------------------------------------------------
@@ -195,49 +190,33 @@ Puzzle::update(Joystick& js)
 void
 Puzzle::draw(Interface565Base& fb)
 {
+    const auto grid = m_tileMap.getGrid();
+    const auto fbd = fb.getDimensions();
+
+    const auto zoom = std::min(fbd.width() / (grid.width() * c_tileWidth),
+                               fbd.height() / (grid.height() * c_tileHeight));
+
+    m_tileMap.setZoom(((zoom > 1) and m_fitToScreen) ? zoom : 1);
+
+    const auto board = m_tileMap.getRectangle();
+    m_tileMap.setOrigin(Point565{(fbd.width() - board.width()) / 2,
+                                 (fbd.height() - board.height()) / 2});
+
+    const auto solved = isSolved();
+
     for (int j = 0 ; j < c_puzzleHeight ; ++j)
     {
         for (int i = 0 ; i < c_puzzleWidth ; ++i)
         {
-           const Point565 p{ i * c_tileWidth,
-                                      j * c_tileHeight };
            const auto tile = m_board[i + (j * c_puzzleWidth)];
+           const auto sprite = ((tile == 0) and solved) ? c_solvedSprite : tile;
 
-           if ((tile == 0) and isSolved())
-           {
-               m_image.putImage(p, m_tileSolved);
-           }
-           else
-           {
-               m_image.putImage(p, m_tileBuffers[tile]);
-           }
+           m_tileMap.setTile(Point565{i, j}, sprite);
         }
     }
 
-    const auto id = m_image.getDimensions();
-    const auto fbd = fb.getDimensions();
-
-    const auto zoom = std::min(fbd.width() / id.width(), fbd.height() / id.height());
-
-    if ((zoom > 1) and m_fitToScreen)
-    {
-        const auto zoomed = scaleUp(m_image, zoom);
-        const auto zd = zoomed.getDimensions();
-
-        const int xOffset = (fbd.width() - zd.width()) / 2;
-        const int yOffset = (fbd.height() - zd.height()) / 2;
+    // only the tiles that moved are drawn, and reported as damage
 
-        const Point565 p{ xOffset, yOffset };
-
-        fb.putImage(p, zoomed);
-    }
-    else
-    {
-        const int xOffset = (fbd.width() - id.width()) / 2;
-        const int yOffset = (fbd.height() - id.height()) / 2;
-
-        const Point565 p{ xOffset, yOffset };
-        fb.putImage(p, m_image);
-    }
+    m_tileMap.draw(fb, m_tiles);
 }
 
@@ -32,9 +32,10 @@
 #include <array>
 #include <cstdint>
 
-#include "image565.h"
 #include "interface565.h"
 #include "joystick.h"
+#include "spriteAtlas565.h"
+#include "tileMap565.h"
 
 #include "images.h"
 
@@ -66,11 +67,16 @@ private:
     static constexpr int c_puzzleHeight{4};
     static constexpr int c_boardSize{c_puzzleWidth * c_puzzleHeight};
 
+    // the tile pieces are sprites 0 to c_tileCount - 1 in the atlas, in
+    // order, followed by the smiley shown in place of the blank when the
+    // puzzle is solved
+
+    static constexpr fb16::SpriteAtlas565::SpriteId c_solvedSprite{c_tileCount};
+
     Location m_blankLocation;
     std::array<uint8_t, c_boardSize> m_board;
     bool m_fitToScreen;
-    fb16::Image565 m_image;
-    std::array<fb16::Image565, c_tileCount> m_tileBuffers;
-    fb16::Image565 m_tileSolved;
+    fb16::SpriteAtlas565 m_tiles;
+    fb16::TileMap565 m_tileMap;
 };
 
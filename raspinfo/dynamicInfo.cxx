@@ -239,7 +239,12 @@ DynamicInfo::DynamicInfo(
     m_heading(255, 255, 0),
     m_foreground(255, 255, 255),
     m_background(0, 0, 0),
-    m_memorySplit(getMemorySplit())
+    m_memorySplit(getMemorySplit()),
+    m_ipHeading{},
+    m_interfaceHeading{},
+    m_memoryHeading{},
+    m_timeHeading{},
+    m_temperatureHeading{}
 {
 }
 
@@ -247,8 +252,13 @@ DynamicInfo::DynamicInfo(
 
 void
 DynamicInfo::init(
-    fb16::Interface565Font&)
+    fb16::Interface565Font& font)
 {
+    m_ipHeading.set(font, "ip(", m_heading);
+    m_interfaceHeading.set(font, ") ", m_heading);
+    m_memoryHeading.set(font, " memory ", m_heading);
+    m_timeHeading.set(font, "time ", m_heading);
+    m_temperatureHeading.set(font, " temperature ", m_heading);
 }
 
 //-------------------------------------------------------------------------
@@ -264,10 +274,7 @@ DynamicInfo::update(
 
     fb16::Point565 position = { 0, 0 };
 
-    position = font.drawString(position,
-                          "ip(",
-                          m_heading,
-                          getImage());
+    position = m_ipHeading.draw(getImage(), position);
 
     const auto ipaddress = getIpAddress();
 
@@ -276,10 +283,7 @@ DynamicInfo::update(
                              m_foreground,
                              getImage());
 
-    position = font.drawString(position,
-                               ") ",
-                               m_heading,
-                               getImage());
+    position = m_interfaceHeading.draw(getImage(), position);
 
     position = font.drawString(position,
                                ipaddress.address,
@@ -288,10 +292,7 @@ DynamicInfo::update(
 
     if (not m_memorySplit.empty())
     {
-        position = font.drawString(position,
-                                " memory ",
-                                m_heading,
-                                getImage());
+        position = m_memoryHeading.draw(getImage(), position);
 
         position = font.drawString(position,
                                 m_memorySplit,
@@ -308,10 +309,7 @@ DynamicInfo::update(
 
     position.set(0, position.y() + font.getPixelDimensions().height() + 4);
 
-    position = font.drawString(position,
-                               "time ",
-                               m_heading,
-                               getImage());
+    position = m_timeHeading.draw(getImage(), position);
 
     std::string timeString = getTime(now);
 
@@ -320,10 +318,7 @@ DynamicInfo::update(
                                m_foreground,
                                getImage());
 
-    position = font.drawString(position,
-                               " temperature ",
-                               m_heading,
-                               getImage());
+    position = m_temperatureHeading.draw(getImage(), position);
 
     const std::string temperatureString = getTemperature();
 
@@ -34,6 +34,7 @@
 
 #include "panel.h"
 #include "rgb565.h"
+#include "textRun565.h"
 
 //-------------------------------------------------------------------------
 
@@ -57,6 +58,14 @@ private:
     fb16::RGB565 m_background;
 
     std::string m_memorySplit;
+
+    // the headings never change, so they are rasterised once in init()
+
+    fb16::TextRun565 m_ipHeading;
+    fb16::TextRun565 m_interfaceHeading;
+    fb16::TextRun565 m_memoryHeading;
+    fb16::TextRun565 m_timeHeading;
+    fb16::TextRun565 m_temperatureHeading;
 };
 
 //-------------------------------------------------------------------------
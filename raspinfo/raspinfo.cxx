@@ -203,18 +203,20 @@ RaspInfo::parseCommandLine(
     int argc,
     char* argv[])
 {
-    static const char* sopts = "d:f:hko";
+    static const char* sopts = "d:f:hklo";
     static option lopts[] =
     {
         { "device", required_argument, nullptr, 'd' },
         { "font", required_argument, nullptr, 'f' },
         { "help", no_argument, nullptr, 'h' },
         { "kmsdrm", no_argument, nullptr, 'k' },
+        { "lcd", no_argument, nullptr, 'l' },
         { "off", no_argument, nullptr, 'o' },
         { nullptr, no_argument, nullptr, 0 }
     };
 
     int opt{0};
+    bool lcdRendering{false};
 
     while ((opt = ::getopt_long(argc, argv, sopts, lopts, nullptr)) != -1)
     {
@@ -240,6 +242,11 @@ RaspInfo::parseCommandLine(
             m_interfaceType = fb16::InterfaceType565::KMSDRM_DUMB_BUFFER_565;
             break;
 
+        case 'l':
+
+            lcdRendering = true;
+            break;
+
         case 'o':
 
             *m_display = false;
@@ -252,6 +259,8 @@ RaspInfo::parseCommandLine(
         }
     }
 
+    m_fontConfig.m_lcdRendering = lcdRendering;
+
     return std::nullopt;
 }
 
@@ -284,6 +293,7 @@ RaspInfo::printUsage(
     std::println(stream, "    --font,-f - font file to use[:pixel height]");
     std::println(stream, "    --help,-h - print usage and exit");
     std::println(stream, "    --kmsdrm,-k - use KMS/DRM dumb buffer");
+    std::println(stream, "    --lcd,-l - subpixel rendering for RGB stripe LCD panels");
     std::println(stream, "    --off,-o - do not display at start");
     std::println(stream, "");
     std::println(stream, "Version: {}", c_projectVersion);
@@ -105,13 +105,13 @@ TraceGraph::draw()
         {
             const auto i1 = i2 - 1;
 
-            const int y1 = (trace.value(i1) * m_traceHeight)/m_traceScale;
-            const int y2 = (trace.value(i2) * m_traceHeight)/m_traceScale;
+            const float y1 = (trace.value(i1) * m_traceHeight)/static_cast<float>(m_traceScale);
+            const float y2 = (trace.value(i2) * m_traceHeight)/static_cast<float>(m_traceScale);
 
-            line(
+            lineAntiAliased(
                 getImage(),
-                fb16::Point565(i1, m_traceHeight - y1),
-                fb16::Point565(i2, m_traceHeight - y2),
+                fb16::PointF(i1, m_traceHeight - y1),
+                fb16::PointF(i2, m_traceHeight - y2),
                 trace.traceColour());
         }
     }
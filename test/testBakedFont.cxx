@@ -0,0 +1,311 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+#include <getopt.h>
+#include <libgen.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <initializer_list>
+#include <iostream>
+#include <print>
+#include <string>
+#include <string_view>
+
+#include "bakedFont.h"
+#include "image565.h"
+#include "image565FontBaked.h"
+#include "image565FreeType.h"
+#include "point.h"
+#include "rectangle.h"
+#include "textRun565.h"
+
+//-------------------------------------------------------------------------
+
+using namespace fb16;
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+constexpr RGB565 c_background{0, 0, 64};
+constexpr RGB565 c_white{255, 255, 255};
+
+// Coverage is baked at four bits a pixel, so a channel may be a step of
+// 255 / 15 out either way, and then a 565 step more after rounding.
+
+constexpr int c_tolerance{16};
+
+constexpr std::array<std::string_view, 3> c_strings
+{
+    "The quick brown fox jumps over the lazy dog",
+    "0123456789 AVAWATo yj",
+    "48°C café ½"
+};
+
+//-------------------------------------------------------------------------
+
+bool
+check(
+    const std::string& name,
+    bool condition)
+{
+    if (not condition)
+    {
+        std::println(std::cerr, "    {} failed", name);
+    }
+
+    return condition;
+}
+
+//-------------------------------------------------------------------------
+
+int
+maxDifference(
+    Image565& a,
+    Image565& b)
+{
+    const auto bufferA = a.getBuffer();
+    const auto bufferB = b.getBuffer();
+    int difference{};
+
+    for (std::size_t i = 0 ; i < bufferA.size() ; ++i)
+    {
+        const RGB565 ca{bufferA[i]};
+        const RGB565 cb{bufferB[i]};
+
+        difference = std::max({difference,
+                                std::abs(ca.getRed() - cb.getRed()),
+                                std::abs(ca.getGreen() - cb.getGreen()),
+                                std::abs(ca.getBlue() - cb.getBlue())});
+    }
+
+    return difference;
+}
+
+//-------------------------------------------------------------------------
+
+// The baked font should lay text out exactly as FreeType does from the
+// same file at the same size, and draw it to within the baked precision.
+
+bool
+testAgainstFreeType(
+    Image565FontBaked& baked,
+    Image565FreeType& freeType)
+{
+    bool passed{true};
+
+    passed &= check("family name", baked.getFontFamilyName() == freeType.getFontFamilyName());
+    passed &= check("style name", baked.getFontStyleName() == freeType.getFontStyleName());
+    passed &= check("pixel dimensions", baked.getPixelDimensions() == freeType.getPixelDimensions());
+
+    const auto height = baked.getPixelDimensions().height();
+
+    for (const auto s : c_strings)
+    {
+        const Point565 p{-3, 2};
+        const auto width = freeType.getStringDimensions(s).width();
+        const Dimensions565 d{width + 6, height + 4};
+
+        Image565 a{d};
+        Image565 b{d};
+
+        a.clear(c_background);
+        b.clear(c_background);
+
+        const auto pa = baked.drawString(p, s, c_white, a);
+        const auto pb = freeType.drawString(p, s, c_white, b);
+
+        passed &= check("string dimensions", baked.getStringDimensions(s) == freeType.getStringDimensions(s));
+        passed &= check("end position", pa == pb);
+        passed &= check("pixels", maxDifference(a, b) <= c_tolerance);
+    }
+
+    return passed;
+}
+
+//-------------------------------------------------------------------------
+
+// Text runs and clipped drawing from the baked font should match its own
+// drawString() exactly, and characters that were not baked draw as '?'.
+
+bool
+testDrawing(
+    Image565FontBaked& baked)
+{
+    bool passed{true};
+
+    const Dimensions565 d{200, 3 * baked.getPixelDimensions().height()};
+    const Rectangle565 clip{Point565{7, 5}, Point565{150, d.height() - 9}};
+
+    for (const auto s : c_strings)
+    {
+        for (const auto clipped : { false, true })
+        {
+            Image565 direct{d};
+            Image565 run{d};
+
+            direct.clear(c_background);
+            run.clear(c_background);
+
+            if (clipped)
+            {
+                direct.pushClip(clip);
+                run.pushClip(clip);
+            }
+
+            const TextRun565 textRun{baked, s, c_white};
+
+            for (const auto& p : { Point565{-5, -3}, Point565{20, 10}, Point565{60, d.height() - 8} })
+            {
+                const auto pd = baked.drawString(p, s, c_white, direct);
+                const auto pr = textRun.draw(run, p);
+
+                passed &= check("text run end position", pd == pr);
+            }
+
+            passed &= check("text run", std::ranges::equal(direct.getBuffer(), run.getBuffer()));
+        }
+    }
+
+    Image565 missing{d};
+    Image565 question{d};
+
+    missing.clear(c_background);
+    question.clear(c_background);
+
+    const auto pm = baked.drawString(Point565{0, 0}, "x─y", c_white, missing);
+    const auto pq = baked.drawString(Point565{0, 0}, "x?y", c_white, question);
+
+    passed &= check("missing character", (pm == pq) and std::ranges::equal(missing.getBuffer(), question.getBuffer()));
+
+    return passed;
+}
+
+//-------------------------------------------------------------------------
+
+void
+printUsage(
+    std::ostream& stream,
+    const std::string& name)
+{
+    std::println(stream, "");
+    std::println(stream, "Usage: {}", name);
+    std::println(stream, "");
+    std::println(stream, "    --help,-h - print usage and exit");
+    std::println(stream, "");
+}
+
+//-------------------------------------------------------------------------
+
+} // namespace
+
+//-------------------------------------------------------------------------
+
+int
+main(
+    int argc,
+    char *argv[])
+{
+    const std::string program{basename(argv[0])};
+
+    //---------------------------------------------------------------------
+
+    static const char* sopts = "h";
+    static option lopts[] =
+    {
+        { "help", no_argument, nullptr, 'h' },
+        { nullptr, no_argument, nullptr, 0 }
+    };
+
+    int opt{};
+
+    while ((opt = ::getopt_long(argc, argv, sopts, lopts, nullptr)) != -1)
+    {
+        switch (opt)
+        {
+        case 'h':
+
+            printUsage(std::cout, program);
+            ::exit(EXIT_SUCCESS);
+            break;
+
+        default:
+
+            printUsage(std::cerr, program);
+            ::exit(EXIT_FAILURE);
+            break;
+        }
+    }
+
+    //---------------------------------------------------------------------
+
+    bool passed{true};
+
+    try
+    {
+        for (const auto* font : c_bakedSizes)
+        {
+            Image565FontBaked baked{*font};
+            Image565FreeType freeType{BAKED_FONT_FILE, baked.getPixelSize()};
+
+            const auto bytes = font->m_coverage.size_bytes() +
+                               font->m_glyphs.size_bytes() +
+                               font->m_kerning.size_bytes();
+
+            std::println("{} {} {} pixels, {} glyphs, {} kerning pairs, {} bytes",
+                         baked.getFontFamilyName(),
+                         baked.getFontStyleName(),
+                         baked.getPixelSize(),
+                         font->m_glyphs.size(),
+                         font->m_kerning.size(),
+                         bytes);
+
+            bool sizePassed{true};
+
+            sizePassed &= testAgainstFreeType(baked, freeType);
+            sizePassed &= testDrawing(baked);
+
+            std::println("    {}", (sizePassed) ? "passed" : "FAILED");
+
+            passed &= sizePassed;
+        }
+    }
+    catch (std::exception& error)
+    {
+        std::println(std::cerr, "Error: {}", error.what());
+        exit(EXIT_FAILURE);
+    }
+
+    return (passed) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
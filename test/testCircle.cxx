@@ -54,6 +54,7 @@ printUsage(
     std::println(stream, "");
     std::println(stream, "Usage: {}", name);
     std::println(stream, "");
+    std::println(stream, "    --antialias,-a - draw anti-aliased circles");
     std::println(stream, "    --device,-d - device to use");
     std::println(stream, "    --help,-h - print usage and exit");
     std::println(stream, "    --kmsdrm,-k - use KMS/DRM dumb buffer");
@@ -67,15 +68,17 @@ main(
     int argc,
     char *argv[])
 {
+    bool antiAlias{false};
     std::string device{};
     const std::string program{basename(argv[0])};
     auto interfaceType{fb16::InterfaceType565::FRAME_BUFFER_565};
 
     //---------------------------------------------------------------------
 
-    static const char* sopts = "d:hk";
+    static const char* sopts = "ad:hk";
     static option lopts[] =
     {
+        { "antialias", no_argument, nullptr, 'a' },
         { "device", required_argument, nullptr, 'd' },
         { "help", no_argument, nullptr, 'h' },
         { "kmsdrm", no_argument, nullptr, 'k' },
@@ -88,6 +91,11 @@ main(
     {
         switch (opt)
         {
+        case 'a':
+
+            antiAlias = true;
+            break;
+
         case 'd':
 
             device = optarg;
@@ -124,8 +132,17 @@ main(
 
         //-----------------------------------------------------------------
 
-        circle(*fb, Point565{60, 60}, 50, white);
-        circleFilled(*fb, Point565{180, 60}, 50, white);
+        if (antiAlias)
+        {
+            circleAntiAliased(*fb, PointF{60.0f, 60.0f}, 50.0f, white);
+            circleFilledAntiAliased(*fb, PointF{180.0f, 60.0f}, 50.0f, white);
+            circleAntiAliased(*fb, PointF{300.5f, 60.25f}, 49.5f, white, 4.0f);
+        }
+        else
+        {
+            circle(*fb, Point565{60, 60}, 50, white);
+            circleFilled(*fb, Point565{180, 60}, 50, white);
+        }
 
         //-----------------------------------------------------------------
 
@@ -0,0 +1,255 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+#include <getopt.h>
+#include <libgen.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <print>
+#include <string>
+
+#include "drawList565.h"
+#include "image565.h"
+#include "image565Font8x16.h"
+#include "image565Graphics.h"
+#include "point.h"
+
+//-------------------------------------------------------------------------
+
+using namespace fb16;
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+// A screen of panels, each with a background, border, trace and label.
+
+template<typename BOX_FILLED, typename BOX, typename LINE, typename TEXT>
+void
+drawPanels(
+    Dimensions565 d,
+    BOX_FILLED boxFilled,
+    BOX box,
+    LINE line,
+    TEXT text)
+{
+    constexpr int panelWidth{150};
+    constexpr int panelHeight{90};
+
+    for (auto y = 0 ; y < d.height() ; y += panelHeight)
+    {
+        for (auto x = 0 ; x < d.width() ; x += panelWidth)
+        {
+            const Point565 p1{x, y};
+            const Point565 p2{x + panelWidth - 1, y + panelHeight - 1};
+            const auto index = (x / panelWidth) + (y / panelHeight);
+
+            boxFilled(p1, p2, RGB565(32, 32, 64 + (index * 16) % 192));
+            box(p1, p2, RGB565(255, 255, 255));
+
+            for (auto i = 0 ; i < 10 ; ++i)
+            {
+                const Point565 l1{x + 5 + (i * 14), y + 80 - ((i * index * 7) % 50)};
+                const Point565 l2{x + 19 + (i * 14), y + 80 - (((i + 1) * index * 7) % 50)};
+
+                line(l1, l2, RGB565(255, 255, 0));
+            }
+
+            // labels that straddle the bands the list is drawn in
+
+            text(Point565{x + 5, y + 5}, "panel " + std::to_string(index));
+            text(Point565{x + 60, y + 40 + (index % 7)}, "Ag");
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
+// Draw the panels directly and through a draw list, with a number of
+// threads, and check they are the same.
+
+bool
+testDrawList(
+    Dimensions565 d,
+    int threads,
+    bool timing)
+{
+    Image565Font8x16 font;
+    DrawList565 drawList;
+
+    drawPanels(
+        d,
+        [&](Point565 p1, Point565 p2, const RGB565& rgb)
+        {
+            drawList.boxFilled(p1, p2, rgb);
+        },
+        [&](Point565 p1, Point565 p2, const RGB565& rgb)
+        {
+            drawList.box(p1, p2, rgb);
+        },
+        [&](Point565 p1, Point565 p2, const RGB565& rgb)
+        {
+            drawList.line(p1, p2, rgb);
+        },
+        [&](Point565 p, const std::string& s)
+        {
+            drawList.text(p, s, RGB565(255, 255, 255), font);
+        });
+
+    Image565 direct{d};
+    Image565 listed{d};
+
+    const auto directStart = std::chrono::steady_clock::now();
+
+    drawPanels(
+        d,
+        [&](Point565 p1, Point565 p2, const RGB565& rgb)
+        {
+            boxFilled(direct, p1, p2, rgb);
+        },
+        [&](Point565 p1, Point565 p2, const RGB565& rgb)
+        {
+            box(direct, p1, p2, rgb);
+        },
+        [&](Point565 p1, Point565 p2, const RGB565& rgb)
+        {
+            line(direct, p1, p2, rgb);
+        },
+        [&](Point565 p, const std::string& s)
+        {
+            font.drawString(p, s, RGB565(255, 255, 255), direct);
+        });
+
+    const auto listStart = std::chrono::steady_clock::now();
+
+    drawList.execute(listed, threads);
+
+    const auto listEnd = std::chrono::steady_clock::now();
+
+    const bool passed = std::ranges::equal(direct.getBuffer(), listed.getBuffer());
+
+    std::println("{}x{} {} commands {} threads {}",
+                 d.width(),
+                 d.height(),
+                 drawList.size(),
+                 threads,
+                 (passed) ? "passed" : "FAILED");
+
+    if (timing)
+    {
+        std::println("    direct {} us, draw list {} us",
+                     std::chrono::duration_cast<std::chrono::microseconds>(listStart - directStart).count(),
+                     std::chrono::duration_cast<std::chrono::microseconds>(listEnd - listStart).count());
+    }
+
+    return passed;
+}
+
+//-------------------------------------------------------------------------
+
+void
+printUsage(
+    std::ostream& stream,
+    const std::string& name)
+{
+    std::println(stream, "");
+    std::println(stream, "Usage: {}", name);
+    std::println(stream, "");
+    std::println(stream, "    --help,-h - print usage and exit");
+    std::println(stream, "    --time,-t - time drawing directly and through the list");
+    std::println(stream, "");
+}
+
+//-------------------------------------------------------------------------
+
+} // namespace
+
+//-------------------------------------------------------------------------
+
+int
+main(
+    int argc,
+    char *argv[])
+{
+    const std::string program{basename(argv[0])};
+    bool timing{false};
+
+    //---------------------------------------------------------------------
+
+    static const char* sopts = "ht";
+    static option lopts[] =
+    {
+        { "help", no_argument, nullptr, 'h' },
+        { "time", no_argument, nullptr, 't' },
+        { nullptr, no_argument, nullptr, 0 }
+    };
+
+    int opt{};
+
+    while ((opt = ::getopt_long(argc, argv, sopts, lopts, nullptr)) != -1)
+    {
+        switch (opt)
+        {
+        case 'h':
+
+            printUsage(std::cout, program);
+            ::exit(EXIT_SUCCESS);
+            break;
+
+        case 't':
+
+            timing = true;
+            break;
+
+        default:
+
+            printUsage(std::cerr, program);
+            ::exit(EXIT_FAILURE);
+            break;
+        }
+    }
+
+    //---------------------------------------------------------------------
+
+    bool passed{true};
+
+    for (const auto d : { Dimensions565{480, 320}, Dimensions565{317, 203} })
+    {
+        for (const auto threads : { 1, 2, 3, 4 })
+        {
+            passed &= testDrawList(d, threads, timing);
+        }
+    }
+
+    return (passed) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
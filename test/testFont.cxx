@@ -58,6 +58,7 @@ printUsage(
     std::println(stream, "    --font,-f - font file to use[:pixel height]");
     std::println(stream, "    --help,-h - print usage and exit");
     std::println(stream, "    --kmsdrm,-k - use KMS/DRM dumb buffer");
+    std::println(stream, "    --lcd,-l - subpixel rendering for RGB stripe LCD panels");
     std::println(stream, "");
 }
 
@@ -71,17 +72,19 @@ main(
     std::string device{};
     const std::string program{basename(argv[0])};
     FontConfig fontConfig{};
+    bool lcdRendering{false};
     auto interfaceType{fb16::InterfaceType565::FRAME_BUFFER_565};
 
     //---------------------------------------------------------------------
 
-    static const char* sopts = "d:f:hk";
+    static const char* sopts = "d:f:hkl";
     static option lopts[] =
     {
         { "device", required_argument, nullptr, 'd' },
         { "font", required_argument, nullptr, 'f' },
         { "help", no_argument, nullptr, 'h' },
         { "kmsdrm", no_argument, nullptr, 'k' },
+        { "lcd", no_argument, nullptr, 'l' },
         { nullptr, no_argument, nullptr, 0 }
     };
 
@@ -112,6 +115,11 @@ main(
             interfaceType = fb16::InterfaceType565::KMSDRM_DUMB_BUFFER_565;
             break;
 
+        case 'l':
+
+            lcdRendering = true;
+            break;
+
         default:
 
             printUsage(std::cerr, program);
@@ -128,6 +136,8 @@ main(
         exit(EXIT_FAILURE);
     }
 
+    fontConfig.m_lcdRendering = lcdRendering;
+
     //---------------------------------------------------------------------
 
     try
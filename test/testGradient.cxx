@@ -0,0 +1,340 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+#include <getopt.h>
+#include <libgen.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <initializer_list>
+#include <iostream>
+#include <print>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "image565.h"
+#include "image565Graphics.h"
+#include "paint565.h"
+#include "point.h"
+
+//-------------------------------------------------------------------------
+
+using namespace fb16;
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+// Stops whose colours are exact in 565, so dithering leaves them alone.
+
+constexpr std::array<GradientStop, 3> c_traffic
+{
+    GradientStop{0.0f, RGB8{0, 255, 0}},
+    GradientStop{0.5f, RGB8{255, 255, 0}},
+    GradientStop{1.0f, RGB8{255, 0, 0}}
+};
+
+//-------------------------------------------------------------------------
+
+bool
+check(
+    const std::string& name,
+    bool condition)
+{
+    if (not condition)
+    {
+        std::println(std::cerr, "    {} failed", name);
+    }
+
+    return condition;
+}
+
+//-------------------------------------------------------------------------
+
+// A span is filled incrementally, so filling it in one go must give the
+// same colours as filling each pixel on its own.
+
+bool
+testIncremental(
+    const Paint565& paint)
+{
+    constexpr int width{400};
+    constexpr int x{-50};
+
+    for (auto y = -3 ; y < 100 ; y += 7)
+    {
+        std::vector<uint16_t> span(width);
+        std::vector<uint16_t> pixels(width);
+
+        paint.fillSpan(span, x, y);
+
+        for (auto i = 0 ; i < width ; ++i)
+        {
+            paint.fillSpan(std::span{pixels}.subspan(i, 1), x + i, y);
+        }
+
+        if (span != pixels)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//-------------------------------------------------------------------------
+
+bool
+testGradients()
+{
+    std::println("gradients");
+
+    bool passed{true};
+
+    for (const auto spread : { GradientSpread::PAD, GradientSpread::REPEAT, GradientSpread::REFLECT })
+    {
+        for (const auto dither : { false, true })
+        {
+            const LinearGradient565 slope{Point565{-20, 7},
+                                          Point565{150, 90},
+                                          c_traffic,
+                                          spread,
+                                          dither};
+
+            const RadialGradient565 glow{Point565{60, 40},
+                                         37,
+                                         c_traffic,
+                                         spread,
+                                         dither};
+
+            passed &= check("linear gradient span", testIncremental(slope));
+            passed &= check("radial gradient span", testIncremental(glow));
+
+            // a horizontal gradient 64 pixels long, from x = 10
+
+            const LinearGradient565 bar{Point565{10, 0},
+                                        Point565{74, 0},
+                                        c_traffic,
+                                        spread,
+                                        dither};
+
+            constexpr int x{-100};
+            std::vector<uint16_t> row(400);
+            bar.fillSpan(row, x, 5);
+
+            auto at = [&row](int column) { return row[column - x]; };
+
+            const auto start = RGB565(c_traffic.front().colour).get565();
+            const auto end = RGB565(c_traffic.back().colour).get565();
+
+            passed &= check("gradient start", at(10) == start);
+
+            switch (spread)
+            {
+            case GradientSpread::PAD:
+
+                for (auto column = x ; column < 10 ; ++column)
+                {
+                    passed &= check("pad before start", at(column) == start);
+                }
+
+                for (auto column = 74 ; column < (x + 400) ; ++column)
+                {
+                    passed &= check("pad after end", at(column) == end);
+                }
+
+                break;
+
+            case GradientSpread::REPEAT:
+
+                for (auto column = x ; column < (x + 400 - 64) ; ++column)
+                {
+                    passed &= check("repeat", at(column) == at(column + 64));
+                }
+
+                break;
+
+            case GradientSpread::REFLECT:
+
+                passed &= check("reflect end", at(74) == end);
+
+                for (auto column = x ; column < (x + 400 - 128) ; ++column)
+                {
+                    passed &= check("reflect", at(column) == at(column + 128));
+                }
+
+                break;
+            }
+        }
+    }
+
+    std::println("    {}", (passed) ? "passed" : "FAILED");
+
+    return passed;
+}
+
+//-------------------------------------------------------------------------
+
+bool
+testPattern()
+{
+    constexpr RGB565 white{255, 255, 255};
+    constexpr RGB565 grey{128, 128, 128};
+    constexpr Dimensions565 d{120, 90};
+
+    std::println("patterns");
+
+    bool passed{true};
+
+    // a checker board, with its origin away from the corner
+
+    Image565 tile{Dimensions565{16, 12}};
+    tile.clear(white);
+    boxFilled(tile, Point565{0, 0}, Point565{7, 5}, grey);
+    boxFilled(tile, Point565{8, 6}, Point565{15, 11}, grey);
+    tile.setPixel(Point565{3, 9}, 0x1234);
+
+    const Point565 origin{5, -3};
+    const Pattern565 checks{tile, origin};
+
+    Image565 image{d};
+    boxFilled(image, Point565{0, 0}, Point565{d.width() - 1, d.height() - 1}, checks);
+
+    for (auto y = 0 ; y < d.height() ; ++y)
+    {
+        for (auto x = 0 ; x < d.width() ; ++x)
+        {
+            const auto td = tile.getDimensions();
+            const Point565 t{(((x - origin.x()) % td.width()) + td.width()) % td.width(),
+                             (((y - origin.y()) % td.height()) + td.height()) % td.height()};
+
+            passed &= check("pattern", image.getPixel(Point565{x, y}) == tile.getPixel(t));
+        }
+    }
+
+    // shapes filled with a paint cover the same pixels as those filled
+    // with a colour
+
+    constexpr uint16_t colour{0x4A69};
+    const Image565 dot{Dimensions565{1, 1}, {colour}};
+    const Pattern565 flat{dot};
+
+    const std::array<Point565, 3> triangle
+    {
+        Point565{50, 2},
+        Point565{95, 75},
+        Point565{3, 60}
+    };
+
+    Image565 painted{d};
+    Image565 coloured{d};
+
+    circleFilled(painted, Point565{50, 40}, 30, flat);
+    circleFilled(coloured, Point565{50, 40}, 30, colour);
+    polygonFilled(painted, triangle, flat);
+    polygonFilled(coloured, triangle, colour);
+    boxFilled(painted, Point565{5, 5}, Point565{20, 70}, flat);
+    boxFilled(coloured, Point565{5, 5}, Point565{20, 70}, colour);
+
+    passed &= check("painted shapes",
+                    std::ranges::equal(painted.getBuffer(), coloured.getBuffer()));
+
+    std::println("    {}", (passed) ? "passed" : "FAILED");
+
+    return passed;
+}
+
+//-------------------------------------------------------------------------
+
+void
+printUsage(
+    std::ostream& stream,
+    const std::string& name)
+{
+    std::println(stream, "");
+    std::println(stream, "Usage: {}", name);
+    std::println(stream, "");
+    std::println(stream, "    --help,-h - print usage and exit");
+    std::println(stream, "");
+}
+
+//-------------------------------------------------------------------------
+
+} // namespace
+
+//-------------------------------------------------------------------------
+
+int
+main(
+    int argc,
+    char *argv[])
+{
+    const std::string program{basename(argv[0])};
+
+    //---------------------------------------------------------------------
+
+    static const char* sopts = "h";
+    static option lopts[] =
+    {
+        { "help", no_argument, nullptr, 'h' },
+        { nullptr, no_argument, nullptr, 0 }
+    };
+
+    int opt{};
+
+    while ((opt = ::getopt_long(argc, argv, sopts, lopts, nullptr)) != -1)
+    {
+        switch (opt)
+        {
+        case 'h':
+
+            printUsage(std::cout, program);
+            ::exit(EXIT_SUCCESS);
+            break;
+
+        default:
+
+            printUsage(std::cerr, program);
+            ::exit(EXIT_FAILURE);
+            break;
+        }
+    }
+
+    //---------------------------------------------------------------------
+
+    bool passed{true};
+
+    passed &= testGradients();
+    passed &= testPattern();
+
+    return (passed) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,318 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+#include <getopt.h>
+#include <libgen.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <print>
+#include <stdexcept>
+#include <string>
+
+#include "image565.h"
+#include "image565Graphics.h"
+#include "image565View.h"
+#include "point.h"
+#include "rectangle.h"
+
+//-------------------------------------------------------------------------
+
+using namespace fb16;
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+bool
+check(
+    const std::string& name,
+    bool condition)
+{
+    if (not condition)
+    {
+        std::println(std::cerr, "    {} failed", name);
+    }
+
+    return condition;
+}
+
+//-------------------------------------------------------------------------
+
+uint16_t
+pixel(
+    const Interface565Base& image,
+    Point565 p)
+{
+    return image.getPixel(p).value_or(0);
+}
+
+//-------------------------------------------------------------------------
+
+// Copies share pixels only until they are written to, and never share
+// pixels whose writable buffer has been handed out.
+
+bool
+testCopies()
+{
+    std::println("copies");
+
+    bool passed{true};
+
+    const Image565 tile{Dimensions565{3, 2}, {1, 2, 3, 4, 5, 6}};
+    Image565 copy{tile};
+
+    passed &= check("copy of an unwritten image is shared", copy.shared());
+
+    copy.setPixel(Point565{0, 0}, 100);
+
+    passed &= check("written copy is unshared", not copy.shared());
+    passed &= check("writing a copy leaves the original", pixel(tile, Point565{0, 0}) == 1);
+    passed &= check("copy is written", pixel(copy, Point565{0, 0}) == 100);
+
+    // a span taken before a copy must not write into the copy
+
+    Image565 image{Dimensions565{8, 8}};
+    auto buffer = image.getBuffer();
+    const Image565 later{image};
+
+    buffer[0] = 0xFFFF;
+
+    passed &= check("copy of a written image is unshared", not later.shared());
+    passed &= check("span taken before a copy", pixel(later, Point565{0, 0}) == 0);
+
+    // nor must a view taken before an assignment
+
+    Image565View view{image, Rectangle565{Point565{2, 2}, Dimensions565{4, 4}}};
+    Image565 assigned;
+    assigned = image;
+
+    view.clear(0x1234);
+
+    passed &= check("view taken before a copy", pixel(assigned, Point565{3, 3}) == 0);
+    passed &= check("view writes into its image", pixel(image, Point565{3, 3}) == 0x1234);
+
+    // an image converted from a view can still be shared
+
+    const Image565 converted{view};
+    const Image565 convertedCopy{converted};
+
+    passed &= check("copy of a converted image is shared", convertedCopy.shared());
+    passed &= check("converted image", pixel(convertedCopy, Point565{1, 1}) == 0x1234);
+
+    std::println("    {}", (passed) ? "passed" : "FAILED");
+
+    return passed;
+}
+
+//-------------------------------------------------------------------------
+
+// Drawing a panel in each quarter of an image through a view of that
+// quarter, with the view's own coordinates and clip, must match drawing
+// the panels on the image itself, offset and clipped to each quarter.
+
+bool
+testViews()
+{
+    std::println("views");
+
+    bool passed{true};
+
+    const Dimensions565 d{161, 97};
+    const Dimensions565 quarter{d.width() / 2, d.height() / 2};
+
+    auto drawPanel = [&quarter](Interface565Base& iface, Point565 offset, int i, int j)
+    {
+        const Point565 centre{offset.x() + (quarter.width() / 2),
+                              offset.y() + (quarter.height() / 2)};
+
+        boxFilled(iface,
+                  offset,
+                  Point565{offset.x() + quarter.width() - 1, offset.y() + quarter.height() - 1},
+                  RGB565(64 + (i * 128), 64 + (j * 128), 128));
+        circleFilled(iface, centre, (quarter.height() / 2) + 20, RGB565(255, 255, 255));
+        line(iface, offset, Point565{centre.x() + 100, centre.y() + 70}, RGB565(255, 0, 0));
+    };
+
+    Image565 viewed{d};
+    Image565 direct{d};
+
+    for (auto j = 0 ; j < 2 ; ++j)
+    {
+        for (auto i = 0 ; i < 2 ; ++i)
+        {
+            // the bottom right view ends at the corner of the image
+
+            const Point565 p{d.width() - ((2 - i) * quarter.width()),
+                             d.height() - ((2 - j) * quarter.height())};
+            const Rectangle565 area{p, quarter};
+
+            Image565View panel{viewed, area};
+            drawPanel(panel, Point565{0, 0}, i, j);
+
+            ScopedClip565 clip{direct, area};
+            drawPanel(direct, p, i, j);
+        }
+    }
+
+    passed &= check("panels", std::ranges::equal(viewed.getBuffer(), direct.getBuffer()));
+
+    auto throws = [&viewed](const Rectangle565& area) -> bool
+    {
+        try
+        {
+            Image565View view{viewed, area};
+        }
+        catch (const std::invalid_argument&)
+        {
+            return true;
+        }
+
+        return false;
+    };
+
+    passed &= check("empty view", throws(Rectangle565{Point565{5, 5}, Dimensions565{0, 5}}));
+    passed &= check("view outside image", throws(Rectangle565{Point565{100, 50}, Dimensions565{62, 10}}));
+    passed &= check("view before image", throws(Rectangle565{Point565{-1, 0}, Dimensions565{10, 10}}));
+
+    std::println("    {}", (passed) ? "passed" : "FAILED");
+
+    return passed;
+}
+
+//-------------------------------------------------------------------------
+
+// setPixel() only tests the clip on top of the stack, so the stack has to
+// stay inside the image, even when the image shrinks under it.
+
+bool
+testClips()
+{
+    std::println("clips");
+
+    bool passed{true};
+
+    Image565 image{Dimensions565{40, 30}};
+
+    passed &= check("unclipped inside", image.setPixel(Point565{39, 29}, 1));
+    passed &= check("unclipped outside", not image.setPixel(Point565{40, 0}, 1));
+
+    image.pushClip(Rectangle565{Point565{-10, -10}, Point565{100, 100}});
+
+    passed &= check("clip larger than image", image.getClip() == Rectangle565{Point565{0, 0}, Dimensions565{40, 30}});
+    passed &= check("large clip outside", not image.setPixel(Point565{-1, 5}, 1));
+
+    image.pushClip(Rectangle565{Point565{10, 5}, Point565{35, 25}});
+    image.setDimensions(Dimensions565{20, 15});
+
+    passed &= check("clip after shrinking", image.getClip() == Rectangle565{Point565{10, 5}, Point565{19, 14}});
+    passed &= check("shrunk clip inside", image.setPixel(Point565{19, 14}, 1));
+    passed &= check("shrunk clip outside", not image.setPixel(Point565{20, 14}, 1));
+
+    image.popClip();
+
+    passed &= check("clip below after shrinking", image.getClip() == Rectangle565{Point565{0, 0}, Dimensions565{20, 15}});
+    passed &= check("shrunk image outside", not image.setPixel(Point565{25, 0}, 1));
+
+    image.popClip();
+
+    std::println("    {}", (passed) ? "passed" : "FAILED");
+
+    return passed;
+}
+
+//-------------------------------------------------------------------------
+
+void
+printUsage(
+    std::ostream& stream,
+    const std::string& name)
+{
+    std::println(stream, "");
+    std::println(stream, "Usage: {}", name);
+    std::println(stream, "");
+    std::println(stream, "    --help,-h - print usage and exit");
+    std::println(stream, "");
+}
+
+//-------------------------------------------------------------------------
+
+} // namespace
+
+//-------------------------------------------------------------------------
+
+int
+main(
+    int argc,
+    char *argv[])
+{
+    const std::string program{basename(argv[0])};
+
+    //---------------------------------------------------------------------
+
+    static const char* sopts = "h";
+    static option lopts[] =
+    {
+        { "help", no_argument, nullptr, 'h' },
+        { nullptr, no_argument, nullptr, 0 }
+    };
+
+    int opt{};
+
+    while ((opt = ::getopt_long(argc, argv, sopts, lopts, nullptr)) != -1)
+    {
+        switch (opt)
+        {
+        case 'h':
+
+            printUsage(std::cout, program);
+            ::exit(EXIT_SUCCESS);
+            break;
+
+        default:
+
+            printUsage(std::cerr, program);
+            ::exit(EXIT_FAILURE);
+            break;
+        }
+    }
+
+    //---------------------------------------------------------------------
+
+    bool passed{true};
+
+    passed &= testCopies();
+    passed &= testViews();
+    passed &= testClips();
+
+    return (passed) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
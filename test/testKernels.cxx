@@ -0,0 +1,572 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <getopt.h>
+#include <libgen.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <print>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "image565.h"
+#include "image565Graphics.h"
+#include "image565Process.h"
+#include "interface565Base.h"
+#include "rgb565.h"
+#include "rgb565Kernels.h"
+
+//-------------------------------------------------------------------------
+
+using namespace fb16;
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+// Every 565 value, plus a few more so the vector kernels have a tail.
+
+constexpr std::size_t c_pixels{65536 + 13};
+
+//-------------------------------------------------------------------------
+
+std::vector<uint16_t>
+allPixels()
+{
+    std::vector<uint16_t> pixels(c_pixels);
+
+    for (std::size_t i = 0 ; i < pixels.size() ; ++i)
+    {
+        pixels[i] = static_cast<uint16_t>(i * 40503);
+    }
+
+    return pixels;
+}
+
+//-------------------------------------------------------------------------
+
+bool
+check(
+    const std::string& name,
+    std::span<const uint16_t> result,
+    std::function<uint16_t(std::size_t)> expected)
+{
+    for (std::size_t i = 0 ; i < result.size() ; ++i)
+    {
+        if (result[i] != expected(i))
+        {
+            std::println(std::cerr,
+                         "    {} failed at {}: {} expected {}",
+                         name,
+                         i,
+                         result[i],
+                         expected(i));
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//-------------------------------------------------------------------------
+
+bool
+testKernels(
+    const RGB565Kernels& kernels)
+{
+    std::println("{} kernels", kernels.name);
+
+    const auto input = allPixels();
+    std::vector<uint16_t> output(input.size());
+    bool passed{true};
+
+    //---------------------------------------------------------------------
+
+    std::vector<uint8_t> red(input.size());
+    std::vector<uint8_t> green(input.size());
+    std::vector<uint8_t> blue(input.size());
+
+    kernels.unpack(input, red, green, blue);
+    kernels.pack(red, green, blue, output);
+
+    passed &= check("unpack", output, [&](std::size_t i)
+    {
+        const RGB8 rgb{input[i]};
+        const bool same = (rgb.red == red[i]) and
+                          (rgb.green == green[i]) and
+                          (rgb.blue == blue[i]);
+
+        return (same) ? output[i] : static_cast<uint16_t>(~output[i]);
+    });
+
+    passed &= check("pack", output, [&](std::size_t i)
+    {
+        return input[i];
+    });
+
+    //---------------------------------------------------------------------
+
+    kernels.grey(input, output);
+
+    passed &= check("grey", output, [&](std::size_t i)
+    {
+        return RGB565(input[i]).toGrey().get565();
+    });
+
+    //---------------------------------------------------------------------
+
+    kernels.maxChannel(input, output);
+
+    passed &= check("maxChannel", output, [&](std::size_t i)
+    {
+        const RGB8 rgb{input[i]};
+        const auto grey = std::max({rgb.red, rgb.green, rgb.blue});
+
+        return RGB565::rgbTo565(grey, grey, grey);
+    });
+
+    //---------------------------------------------------------------------
+
+    std::vector<uint32_t> scales(input.size());
+
+    for (std::size_t i = 0 ; i < scales.size() ; ++i)
+    {
+        scales[i] = static_cast<uint32_t>((i * 2654435761U) % (8U << 16));
+    }
+
+    kernels.scale(input, scales, output);
+
+    passed &= check("scale", output, [&](std::size_t i)
+    {
+        const RGB8 rgb{input[i]};
+
+        auto channel = [&](uint32_t c) -> uint8_t
+        {
+            return std::min((c * scales[i]) >> 16, 255U);
+        };
+
+        return RGB565::rgbTo565(channel(rgb.red),
+                                channel(rgb.green),
+                                channel(rgb.blue));
+    });
+
+    //---------------------------------------------------------------------
+
+    constexpr RGB565 foreground{255, 128, 7};
+
+    for (int alpha = 0 ; alpha < 256 ; ++alpha)
+    {
+        output = input;
+        kernels.blend(foreground.get565(), alpha, output);
+
+        passed &= check("blend", output, [&](std::size_t i)
+        {
+            return foreground.blend(alpha, RGB565(input[i])).get565();
+        });
+    }
+
+    //---------------------------------------------------------------------
+
+    std::vector<uint8_t> coverage(input.size());
+
+    for (std::size_t i = 0 ; i < coverage.size() ; ++i)
+    {
+        coverage[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    output = input;
+    kernels.blendCoverage(foreground.get565(), coverage, output);
+
+    passed &= check("blendCoverage", output, [&](std::size_t i)
+    {
+        return foreground.blend(coverage[i], RGB565(input[i])).get565();
+    });
+
+    //---------------------------------------------------------------------
+
+    std::vector<uint8_t> coverageLcd(input.size() * 3);
+
+    for (std::size_t i = 0 ; i < coverageLcd.size() ; ++i)
+    {
+        coverageLcd[i] = static_cast<uint8_t>(i * 11);
+    }
+
+    output = input;
+    kernels.blendCoverageLcd(foreground.get565(), coverageLcd, output);
+
+    passed &= check("blendCoverageLcd", output, [&](std::size_t i)
+    {
+        const RGB565 background{input[i]};
+        const auto* alpha{coverageLcd.data() + (i * 3)};
+
+        auto channel = [](uint8_t alpha, int f, int b) -> int
+        {
+            return ((f * alpha) + (b * (255 - alpha))) / 255;
+        };
+
+        return RGB565::rgbTo565(channel(alpha[0], foreground.getRed(), background.getRed()),
+                                channel(alpha[1], foreground.getGreen(), background.getGreen()),
+                                channel(alpha[2], foreground.getBlue(), background.getBlue()));
+    });
+
+    //---------------------------------------------------------------------
+    // Fill every start alignment and length around the vector width, and
+    // check nothing either side is touched.
+
+    for (const auto fill : { kernels.fill, kernels.fillStream })
+    {
+        for (std::size_t start = 0 ; start < 40 ; ++start)
+        {
+            for (std::size_t length = 0 ; length < 80 ; ++length)
+            {
+                output = input;
+                fill(foreground.get565(), std::span(output).subspan(start, length));
+
+                passed &= check("fill", output, [&](std::size_t i)
+                {
+                    const bool filled = (i >= start) and (i < (start + length));
+                    return (filled) ? foreground.get565() : input[i];
+                });
+            }
+        }
+    }
+
+    //---------------------------------------------------------------------
+
+    std::println("    {}", (passed) ? "passed" : "FAILED");
+
+    return passed;
+}
+
+//-------------------------------------------------------------------------
+
+// The enlighten algorithm as it was before it used the colour kernels.
+
+Image565
+enlightenReference(
+    const Image565& input,
+    double strength)
+{
+    auto flerp = [](double value1, double value2, double alpha)->double
+    {
+        return (value1 * (1.0 - alpha)) + (value2 * alpha);
+    };
+
+    auto scaled = [](uint8_t channel, double scale)->uint8_t
+    {
+        return static_cast<uint8_t>(std::clamp(channel * scale, 0.0, 255.0));
+    };
+
+    const auto mb = boxBlur(maxRGB(input), 12);
+
+    const auto strength2 = strength * strength;
+    const auto minI = 1.0 / flerp(1.0, 10.0, strength2);
+    const auto maxI = 1.0 / flerp(1.0, 1.111, strength2);
+
+    Image565 output{input};
+    auto outputi = output.getBuffer().begin();
+    auto mbi = mb.getBuffer().begin();
+
+    for (const auto pixel : input.getBuffer())
+    {
+        RGB565 c{pixel};
+        const auto rgb8 = c.getRGB8();
+        const auto max = RGB8(*(mbi++)).red;
+        const auto illumination = std::clamp(max / 255.0, minI, maxI);
+
+        if (illumination < maxI)
+        {
+            const auto r = illumination / maxI;
+            const auto scale = (0.4 + (r * 0.6)) / r;
+
+            c.setRGB(scaled(rgb8.red, scale),
+                     scaled(rgb8.green, scale),
+                     scaled(rgb8.blue, scale));
+        }
+
+        *(outputi++) = c.get565();
+    }
+
+    return output;
+}
+
+//-------------------------------------------------------------------------
+
+bool
+testProcess()
+{
+    std::println("image processing");
+
+    std::mt19937 generator{565};
+    Image565 image{Dimensions565{331, 173}};
+
+    for (auto& pixel : image.getBuffer())
+    {
+        pixel = static_cast<uint16_t>(generator());
+    }
+
+    bool passed{true};
+
+    const auto grey = toGrey(image);
+
+    passed &= check("toGrey", grey.getBuffer(), [&](std::size_t i)
+    {
+        return RGB565(image.getBuffer()[i]).toGrey().get565();
+    });
+
+    for (const auto strength : { 0.0, 0.25, 0.5, 0.75, 1.0, 2.0 })
+    {
+        const auto expected = enlightenReference(image, strength);
+        const auto result = enlighten(image, strength);
+
+        passed &= check("enlighten", result.getBuffer(), [&](std::size_t i)
+        {
+            return expected.getBuffer()[i];
+        });
+    }
+
+    std::println("    {}", (passed) ? "passed" : "FAILED");
+
+    return passed;
+}
+
+//-------------------------------------------------------------------------
+
+// An image that says it is device memory, so drawing on it fills with the
+// streaming kernel, as on a mapped frame buffer.
+
+class DeviceImage565
+:
+    public Interface565Base
+{
+public:
+
+    explicit DeviceImage565(Dimensions565 d)
+    :
+        m_dimensions{d},
+        m_buffer(static_cast<std::size_t>(d.width() * d.height()))
+    {
+    }
+
+    [[nodiscard]] Dimensions565 getDimensions() const noexcept final { return m_dimensions; }
+
+    [[nodiscard]] std::span<uint16_t> getBuffer() & noexcept final { return m_buffer; }
+    [[nodiscard]] std::span<const uint16_t> getBuffer() const & noexcept final { return m_buffer; }
+
+    [[nodiscard]] int getLineLengthPixels() const noexcept final { return m_dimensions.width(); }
+
+    [[nodiscard]] std::size_t
+    offset(const Point565 p) const noexcept final
+    {
+        return p.x() + (p.y() * m_dimensions.width());
+    }
+
+    [[nodiscard]] bool deviceMemory() const noexcept final { return true; }
+
+private:
+
+    Dimensions565 m_dimensions;
+    std::vector<uint16_t> m_buffer;
+};
+
+//-------------------------------------------------------------------------
+
+// The shapes filled a span at a time must draw the same on device memory
+// (the streaming fill) as on an image in memory.
+
+bool
+testSpanFills()
+{
+    std::println("span fills");
+
+    const Dimensions565 d{157, 101};
+    const RGB565 rgb{200, 40, 120};
+    const std::vector<Point565> vertices{{3, 90}, {60, 4}, {150, 70}, {90, 98}};
+
+    auto draw = [&](Interface565Base& iface)
+    {
+        iface.clear(RGB565{10, 20, 30});
+        horizontalLine(iface, -5, 200, 3, rgb);
+        circleFilled(iface, Point565{40, 40}, 37, rgb);
+        circleThick(iface, Point565{110, 50}, 30, 9, rgb);
+        lineThick(iface, Point565{2, 97}, Point565{154, 11}, 7, rgb, LineCap::ROUND);
+        polylineThick(iface, vertices, 5, rgb, LineJoin::MITER, LineCap::SQUARE);
+        boxRoundedFilled(iface, Point565{70, 5}, Point565{150, 45}, 12, rgb);
+        boxRounded(iface, Point565{5, 60}, Point565{80, 99}, 10, 4, rgb);
+        arc(iface, Point565{80, 50}, 45, 135.0f, 405.0f, 6, rgb);
+        arcFilled(iface, Point565{120, 80}, 19, 30.0f, 250.0f, rgb);
+    };
+
+    Image565 image{d};
+    DeviceImage565 device{d};
+
+    draw(image);
+    draw(device);
+
+    const auto expected = image.getBuffer();
+    const bool passed = check("span fills", device.getBuffer(), [&](std::size_t i)
+    {
+        return expected[i];
+    });
+
+    std::println("    {}", (passed) ? "passed" : "FAILED");
+
+    return passed;
+}
+
+//-------------------------------------------------------------------------
+
+void
+timeKernels(
+    const RGB565Kernels& kernels)
+{
+    std::vector<uint16_t> input(1920 * 1080);
+    std::vector<uint16_t> output(input.size());
+    std::vector<uint32_t> scales(input.size(), 3 << 15);
+
+    for (std::size_t i = 0 ; i < input.size() ; ++i)
+    {
+        input[i] = static_cast<uint16_t>(i * 40503);
+    }
+
+    auto time = [](const std::string& name, std::function<void()> kernel)
+    {
+        constexpr int iterations{20};
+        const auto start = std::chrono::steady_clock::now();
+
+        for (int i = 0 ; i < iterations ; ++i)
+        {
+            kernel();
+        }
+
+        const auto end = std::chrono::steady_clock::now();
+        const auto us = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+        std::println("    {} {} us", name, us.count() / iterations);
+    };
+
+    std::println("{} kernels 1920x1080", kernels.name);
+
+    time("grey", [&] { kernels.grey(input, output); });
+    time("maxChannel", [&] { kernels.maxChannel(input, output); });
+    time("scale", [&] { kernels.scale(input, scales, output); });
+    time("blend", [&] { kernels.blend(0xFFFF, 100, output); });
+    time("fill", [&] { kernels.fill(0xFFFF, output); });
+    time("fillStream", [&] { kernels.fillStream(0xFFFF, output); });
+}
+
+//-------------------------------------------------------------------------
+
+void
+printUsage(
+    std::ostream& stream,
+    const std::string& name)
+{
+    std::println(stream, "");
+    std::println(stream, "Usage: {}", name);
+    std::println(stream, "");
+    std::println(stream, "    --help,-h - print usage and exit");
+    std::println(stream, "    --time,-t - time each set of kernels");
+    std::println(stream, "");
+}
+
+//-------------------------------------------------------------------------
+
+} // namespace
+
+//-------------------------------------------------------------------------
+
+int
+main(
+    int argc,
+    char *argv[])
+{
+    const std::string program{basename(argv[0])};
+    bool timing{false};
+
+    //---------------------------------------------------------------------
+
+    static const char* sopts = "ht";
+    static option lopts[] =
+    {
+        { "help", no_argument, nullptr, 'h' },
+        { "time", no_argument, nullptr, 't' },
+        { nullptr, no_argument, nullptr, 0 }
+    };
+
+    int opt{};
+
+    while ((opt = ::getopt_long(argc, argv, sopts, lopts, nullptr)) != -1)
+    {
+        switch (opt)
+        {
+        case 'h':
+
+            printUsage(std::cout, program);
+            ::exit(EXIT_SUCCESS);
+            break;
+
+        case 't':
+
+            timing = true;
+            break;
+
+        default:
+
+            printUsage(std::cerr, program);
+            ::exit(EXIT_FAILURE);
+            break;
+        }
+    }
+
+    //---------------------------------------------------------------------
+
+    bool passed{true};
+
+    passed &= testKernels(rgb565KernelsScalar());
+    passed &= testKernels(rgb565Kernels());
+    passed &= testProcess();
+    passed &= testSpanFills();
+
+    if (timing)
+    {
+        timeKernels(rgb565KernelsScalar());
+        timeKernels(rgb565Kernels());
+    }
+
+    return (passed) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
@@ -55,6 +55,7 @@ printUsage(
     std::println(stream, "");
     std::println(stream, "Usage: {}", name);
     std::println(stream, "");
+    std::println(stream, "    --antialias,-a - draw anti-aliased lines");
     std::println(stream, "    --device,-d - device to use");
     std::println(stream, "    --help,-h - print usage and exit");
     std::println(stream, "    --kmsdrm,-k - use KMS/DRM dumb buffer");
@@ -68,15 +69,17 @@ main(
     int argc,
     char *argv[])
 {
+    bool antiAlias{false};
     std::string device{};
     const std::string program{basename(argv[0])};
     auto interfaceType{fb16::InterfaceType565::FRAME_BUFFER_565};
 
     //---------------------------------------------------------------------
 
-    static const char* sopts = "d:hk";
+    static const char* sopts = "ad:hk";
     static option lopts[] =
     {
+        { "antialias", no_argument, nullptr, 'a' },
         { "device", required_argument, nullptr, 'd' },
         { "help", no_argument, nullptr, 'h' },
         { "kmsdrm", no_argument, nullptr, 'k' },
@@ -89,6 +92,11 @@ main(
     {
         switch (opt)
         {
+        case 'a':
+
+            antiAlias = true;
+            break;
+
         case 'd':
 
             device = optarg;
@@ -152,7 +160,26 @@ main(
                 center.y() - static_cast<int>(outerRadius * cosValue)
             };
 
-            fb16::line(*fb, inner, outer, white);
+            if (antiAlias)
+            {
+                const fb16::PointF centerF{ halfWidth + 0.0f, halfHeight + 0.0f };
+
+                const fb16::PointF innerF{
+                    centerF.x() + static_cast<float>(innerRadius * sinValue),
+                    centerF.y() - static_cast<float>(innerRadius * cosValue)
+                };
+
+                const fb16::PointF outerF{
+                    centerF.x() + static_cast<float>(outerRadius * sinValue),
+                    centerF.y() - static_cast<float>(outerRadius * cosValue)
+                };
+
+                fb16::lineAntiAliased(*fb, innerF, outerF, white, 1.0f + (i % 4));
+            }
+            else
+            {
+                fb16::line(*fb, inner, outer, white);
+            }
         }
 
         //-----------------------------------------------------------------
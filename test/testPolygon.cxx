@@ -61,6 +61,8 @@ printUsage(
     std::println(stream, "    --device,-d - device to use");
     std::println(stream, "    --help,-h - print usage and exit");
     std::println(stream, "    --kmsdrm,-k - use KMS/DRM dumb buffer");
+    std::println(stream, "    --pentagram,-p - draw self intersecting stars, even-odd and");
+    std::println(stream, "                     non-zero fill on alternate rows");
     std::println(stream, "");
 }
 
@@ -74,15 +76,17 @@ main(
     std::string device{};
     const std::string program{basename(argv[0])};
     auto interfaceType{fb16::InterfaceType565::FRAME_BUFFER_565};
+    bool pentagram{false};
 
     //---------------------------------------------------------------------
 
-    static const char* sopts = "d:hk";
+    static const char* sopts = "d:hkp";
     static option lopts[] =
     {
         { "device", required_argument, nullptr, 'd' },
         { "help", no_argument, nullptr, 'h' },
         { "kmsdrm", no_argument, nullptr, 'k' },
+        { "pentagram", no_argument, nullptr, 'p' },
         { nullptr, no_argument, nullptr, 0 }
     };
 
@@ -108,6 +112,11 @@ main(
             interfaceType = fb16::InterfaceType565::KMSDRM_DUMB_BUFFER_565;
             break;
 
+        case 'p':
+
+            pentagram = true;
+            break;
+
         default:
 
             printUsage(std::cerr, program);
@@ -173,8 +182,28 @@ main(
                     starVertex(9, radius, i, j)
                 };
 
-                polygonFilled(*fb, starVertices, white);
-                polygon(*fb, starVertices, black);
+                if (pentagram)
+                {
+                    const std::array<Point565, 5> pentagramVertices{
+                        starVertex(0, radius, i, j),
+                        starVertex(4, radius, i, j),
+                        starVertex(8, radius, i, j),
+                        starVertex(2, radius, i, j),
+                        starVertex(6, radius, i, j)
+                    };
+
+                    const auto rule = (index % 2 == 0)
+                                    ? FillRule::EVEN_ODD
+                                    : FillRule::NON_ZERO;
+
+                    polygonFilled(*fb, pentagramVertices, white, rule);
+                    polygon(*fb, pentagramVertices, black);
+                }
+                else
+                {
+                    polygonFilled(*fb, starVertices, white);
+                    polygon(*fb, starVertices, black);
+                }
             }
         }
 
@@ -33,8 +33,10 @@
 #include <chrono>
 #include <csignal>
 #include <cstring>
+#include <initializer_list>
 #include <iostream>
 #include <print>
+#include <string>
 #include <system_error>
 #include <thread>
 
@@ -44,6 +46,7 @@
 #include "image565Process.h"
 #include "interface565Factory.h"
 #include "point.h"
+#include "rectangle.h"
 
 //-------------------------------------------------------------------------
 
@@ -91,6 +94,126 @@ printUsage(
 
 //-------------------------------------------------------------------------
 
+// Where the pixel at p of an image with dimensions id lands when the
+// image is given the orientation.
+
+Point565
+orientedPoint(
+    Point565 p,
+    Dimensions565 id,
+    Orientation565 orientation)
+{
+    switch (orientation)
+    {
+    case Orientation565::ROTATE_90:
+
+        return Point565{id.height() - p.y() - 1, p.x()};
+
+    case Orientation565::ROTATE_180:
+
+        return Point565{id.width() - p.x() - 1, id.height() - p.y() - 1};
+
+    case Orientation565::ROTATE_270:
+
+        return Point565{p.y(), id.width() - p.x() - 1};
+
+    default:
+
+        return p;
+    }
+}
+
+//-------------------------------------------------------------------------
+
+// Check rotate90, rotate270 and orientTo, over whole images and areas,
+// for sizes that are odd, not square and not a multiple of the tile or
+// block sizes, so the edge handling is exercised.
+
+bool
+checkOrientations()
+{
+    bool ok{true};
+
+    auto check = [&ok](const Image565& image,
+                       const Image565& output,
+                       Orientation565 orientation,
+                       const Rectangle565& area,
+                       const std::string& name)
+    {
+        const auto id = image.getDimensions();
+
+        for (auto j = 0 ; j < id.height() ; ++j)
+        {
+            for (auto i = 0 ; i < id.width() ; ++i)
+            {
+                const Point565 p{i, j};
+                const uint16_t expected = (area.contains(p)) ? *image.getPixel(p) : 0;
+                const auto pixel = output.getPixel(orientedPoint(p, id, orientation));
+
+                if (pixel != expected)
+                {
+                    std::println(std::cerr,
+                                 "Error: {} {}x{} pixel ({}, {})",
+                                 name,
+                                 id.width(),
+                                 id.height(),
+                                 i,
+                                 j);
+                    ok = false;
+                    return;
+                }
+            }
+        }
+    };
+
+    for (const auto id : { Dimensions565{1, 1},
+                           Dimensions565{7, 3},
+                           Dimensions565{9, 8},
+                           Dimensions565{63, 65},
+                           Dimensions565{70, 130},
+                           Dimensions565{129, 67} })
+    {
+        Image565 image{id};
+
+        for (auto j = 0 ; j < id.height() ; ++j)
+        {
+            for (auto i = 0 ; i < id.width() ; ++i)
+            {
+                image.setPixel(Point565{i, j}, static_cast<uint16_t>((j * 256) + i + 1));
+            }
+        }
+
+        const Rectangle565 all{Point565{0, 0}, id};
+        const Rectangle565 area{Point565{id.width() / 3, id.height() / 4},
+                                Dimensions565{(id.width() + 1) / 2, (id.height() + 1) / 2}};
+
+        check(image, rotate90(image), Orientation565::ROTATE_90, all, "rotate90");
+        check(image, rotate270(image), Orientation565::ROTATE_270, all, "rotate270");
+
+        for (const auto orientation : { Orientation565::ROTATE_0,
+                                        Orientation565::ROTATE_90,
+                                        Orientation565::ROTATE_180,
+                                        Orientation565::ROTATE_270 })
+        {
+            const bool transpose = (orientation == Orientation565::ROTATE_90) or
+                                   (orientation == Orientation565::ROTATE_270);
+            const auto od = (transpose) ? Dimensions565{id.height(), id.width()} : id;
+
+            Image565 output{od};
+            orientTo(image, output, orientation);
+            check(image, output, orientation, all, "orientTo");
+
+            output.clear();
+            orientTo(image, output, orientation, area);
+            check(image, output, orientation, area, "orientTo area");
+        }
+    }
+
+    return ok;
+}
+
+//-------------------------------------------------------------------------
+
 int
 main(
     int argc,
@@ -166,6 +289,11 @@ main(
 
     try
     {
+        if (not checkOrientations())
+        {
+            exit(EXIT_FAILURE);
+        }
+
         auto fb{fb16::createInterface565(interfaceType, device)};
         const auto fbd = fb->getDimensions();
 
@@ -200,6 +328,8 @@ main(
 
         auto degreeChar = font.getCharacterCode(Interface565Font::CharacterCode::DEGREE_SYMBOL).value_or(' ');
 
+        Image565 rotated;
+
         for (int angle = 0; (angle < 3600) and run; ++angle)
         {
             fb->clear(darkGrey);
@@ -210,7 +340,7 @@ main(
                 white,
                 *fb);
 
-            const auto rotated = rotate(image, darkGrey, angle / 10.0);
+            rotateTo(image, rotated, darkGrey, angle / 10.0);
             const auto rd = rotated.getDimensions();
             const Point565 p
             {
@@ -0,0 +1,316 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+#include <getopt.h>
+#include <libgen.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <print>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "image565.h"
+#include "image565Process.h"
+#include "point.h"
+#include "rectangle.h"
+#include "spriteAtlas565.h"
+
+//-------------------------------------------------------------------------
+
+using namespace fb16;
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+bool
+check(
+    const std::string& name,
+    bool condition)
+{
+    if (not condition)
+    {
+        std::println(std::cerr, "    {} failed", name);
+    }
+
+    return condition;
+}
+
+//-------------------------------------------------------------------------
+
+// Sprites of random sizes and pixels, and an atlas of them all.
+
+struct Sprites
+{
+    std::vector<Image565> m_images{};
+    SpriteAtlas565 m_atlas{128};
+};
+
+Sprites
+makeSprites(
+    std::mt19937& generator)
+{
+    std::uniform_int_distribution<int> size{1, 40};
+    Sprites sprites;
+
+    for (auto i = 0 ; i < 100 ; ++i)
+    {
+        auto& image = sprites.m_images.emplace_back(Dimensions565{size(generator), size(generator)});
+
+        for (auto& pixel : image.getBuffer())
+        {
+            pixel = static_cast<uint16_t>(generator());
+        }
+
+        sprites.m_atlas.add(image);
+    }
+
+    return sprites;
+}
+
+//-------------------------------------------------------------------------
+
+bool
+testPacking(
+    const Sprites& sprites)
+{
+    const auto& atlas = sprites.m_atlas;
+    const Rectangle565 bounds{Point565{0, 0}, atlas.getDimensions()};
+
+    bool passed{check("size", atlas.size() == sprites.m_images.size())};
+
+    for (std::size_t i = 0 ; i < atlas.size() ; ++i)
+    {
+        const auto& r = atlas.getRectangle(i);
+
+        passed &= check("sprite size", r.dimensions() == sprites.m_images[i].getDimensions());
+        passed &= check("sprite inside atlas", bounds.contains(r));
+
+        for (std::size_t j = i + 1 ; j < atlas.size() ; ++j)
+        {
+            passed &= check("sprites overlap", r.intersection(atlas.getRectangle(j)).empty());
+        }
+    }
+
+    bool threw{false};
+
+    try
+    {
+        [[maybe_unused]] const auto& r = atlas.getRectangle(atlas.size());
+    }
+    catch (const std::out_of_range&)
+    {
+        threw = true;
+    }
+
+    passed &= check("unknown sprite", threw);
+
+    threw = false;
+
+    try
+    {
+        SpriteAtlas565 narrow{16};
+        narrow.add(Image565{Dimensions565{17, 1}});
+    }
+    catch (const std::invalid_argument&)
+    {
+        threw = true;
+    }
+
+    passed &= check("sprite too wide", threw);
+
+    return passed;
+}
+
+//-------------------------------------------------------------------------
+
+// Drawing sprites from the atlas, clipped and zoomed, must match drawing
+// each image with putImage().
+
+bool
+testDrawing(
+    const Sprites& sprites,
+    std::mt19937& generator,
+    bool timing)
+{
+    const auto& atlas = sprites.m_atlas;
+    const Dimensions565 d{100, 80};
+
+    auto random = [&generator](int a, int b)
+    {
+        return std::uniform_int_distribution<int>{a, b}(generator);
+    };
+
+    bool passed{true};
+    std::chrono::microseconds directTime{};
+    std::chrono::microseconds atlasTime{};
+
+    for (auto test = 0 ; test < 300 ; ++test)
+    {
+        Image565 direct{d};
+        Image565 batched{d};
+
+        const Rectangle565 clip{Point565{random(-10, 90), random(-10, 70)},
+                                Dimensions565{random(0, 80), random(0, 80)}};
+
+        direct.pushClip(clip);
+        batched.pushClip(clip);
+
+        const auto zoom = (test % 3) + 1;
+        std::vector<SpriteAtlas565::Placement> placements;
+
+        for (auto i = 0 ; i < 30 ; ++i)
+        {
+            placements.push_back({static_cast<std::size_t>(random(0, static_cast<int>(atlas.size()) - 1)),
+                                  Point565{random(-50, 110), random(-50, 90)}});
+        }
+
+        const auto directStart = std::chrono::steady_clock::now();
+
+        for (const auto& [id, p] : placements)
+        {
+            if (zoom == 1)
+            {
+                direct.putImage(p, sprites.m_images[id]);
+            }
+            else
+            {
+                scaleUpTo(sprites.m_images[id], direct, p, static_cast<uint8_t>(zoom));
+            }
+        }
+
+        const auto atlasStart = std::chrono::steady_clock::now();
+
+        atlas.drawSprites(batched, placements, zoom);
+
+        const auto atlasEnd = std::chrono::steady_clock::now();
+
+        directTime += std::chrono::duration_cast<std::chrono::microseconds>(atlasStart - directStart);
+        atlasTime += std::chrono::duration_cast<std::chrono::microseconds>(atlasEnd - atlasStart);
+
+        passed &= check("sprites drawn", std::ranges::equal(direct.getBuffer(), batched.getBuffer()));
+    }
+
+    if (timing)
+    {
+        std::println("    putImage {} us, atlas {} us", directTime.count(), atlasTime.count());
+    }
+
+    return passed;
+}
+
+//-------------------------------------------------------------------------
+
+void
+printUsage(
+    std::ostream& stream,
+    const std::string& name)
+{
+    std::println(stream, "");
+    std::println(stream, "Usage: {}", name);
+    std::println(stream, "");
+    std::println(stream, "    --help,-h - print usage and exit");
+    std::println(stream, "    --time,-t - time drawing with putImage() and from the atlas");
+    std::println(stream, "");
+}
+
+//-------------------------------------------------------------------------
+
+} // namespace
+
+//-------------------------------------------------------------------------
+
+int
+main(
+    int argc,
+    char *argv[])
+{
+    const std::string program{basename(argv[0])};
+    bool timing{false};
+
+    //---------------------------------------------------------------------
+
+    static const char* sopts = "ht";
+    static option lopts[] =
+    {
+        { "help", no_argument, nullptr, 'h' },
+        { "time", no_argument, nullptr, 't' },
+        { nullptr, no_argument, nullptr, 0 }
+    };
+
+    int opt{};
+
+    while ((opt = ::getopt_long(argc, argv, sopts, lopts, nullptr)) != -1)
+    {
+        switch (opt)
+        {
+        case 'h':
+
+            printUsage(std::cout, program);
+            ::exit(EXIT_SUCCESS);
+            break;
+
+        case 't':
+
+            timing = true;
+            break;
+
+        default:
+
+            printUsage(std::cerr, program);
+            ::exit(EXIT_FAILURE);
+            break;
+        }
+    }
+
+    //---------------------------------------------------------------------
+
+    std::mt19937 generator{565};
+    const auto sprites = makeSprites(generator);
+    const auto ad = sprites.m_atlas.getDimensions();
+
+    std::println("{} sprites packed into {}x{}", sprites.m_atlas.size(), ad.width(), ad.height());
+
+    bool passed{true};
+
+    passed &= testPacking(sprites);
+    passed &= testDrawing(sprites, generator, timing);
+
+    std::println("    {}", (passed) ? "passed" : "FAILED");
+
+    return (passed) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,316 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+#include <getopt.h>
+#include <libgen.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <print>
+#include <string>
+#include <vector>
+
+#include "image565.h"
+#include "image565Graphics.h"
+#include "point.h"
+#include "rectangle.h"
+
+//-------------------------------------------------------------------------
+
+using namespace fb16;
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+constexpr Dimensions565 c_dimensions{160, 120};
+constexpr Point565 c_centre{80, 60};
+constexpr uint16_t c_white{0xFFFF};
+
+//-------------------------------------------------------------------------
+
+Image565
+drawn(
+    const std::function<void(Image565&)>& draw)
+{
+    Image565 image{c_dimensions};
+    draw(image);
+
+    return image;
+}
+
+//-------------------------------------------------------------------------
+
+bool
+check(
+    const std::string& name,
+    const Image565& result,
+    const Image565& expected)
+{
+    const bool same = std::ranges::equal(result.getBuffer(), expected.getBuffer());
+
+    if (not same)
+    {
+        std::println(std::cerr, "    {} failed", name);
+    }
+
+    return same;
+}
+
+//-------------------------------------------------------------------------
+
+Image565
+mirrored(
+    const Image565& image)
+{
+    Image565 mirror{c_dimensions};
+
+    for (auto y = 0 ; y < c_dimensions.height() ; ++y)
+    {
+        for (auto x = 0 ; x < c_dimensions.width() ; ++x)
+        {
+            const Point565 p{c_dimensions.width() - 1 - x, y};
+            mirror.setPixel(p, image.getPixel(Point565{x, y}).value_or(0));
+        }
+    }
+
+    return mirror;
+}
+
+//-------------------------------------------------------------------------
+
+// A gauge, a pie chart, a progress bar and a graph with each kind of join.
+
+void
+drawWidgets(
+    Interface565Base& iface)
+{
+    constexpr RGB565 grey{64, 64, 64};
+    constexpr RGB565 green{0, 255, 0};
+    constexpr RGB565 orange{255, 165, 0};
+
+    arc(iface, c_centre, 50, 135.0f, 405.0f, 12, grey);
+    arc(iface, c_centre, 50, 135.0f, 135.0f + (0.6f * 270.0f), 12, green);
+    lineThick(iface, c_centre, Point565{105, 35}, 4, c_white, LineCap::ROUND);
+    circleThick(iface, c_centre, 6, 3, c_white);
+
+    arcFilled(iface, Point565{30, 30}, 25, -90.0f, 30.0f, orange);
+    arcFilled(iface, Point565{30, 30}, 25, 30.0f, 270.0f, grey);
+
+    boxRoundedFilled(iface, Point565{5, 90}, Point565{150, 110}, 10, grey);
+    boxRoundedFilled(iface, Point565{5, 90}, Point565{100, 110}, 10, green);
+    boxRounded(iface, Point565{5, 90}, Point565{150, 110}, 10, 2, c_white);
+
+    constexpr std::array<Point565, 5> trace
+    {
+        Point565{10, 80},
+        Point565{40, 40},
+        Point565{70, 70},
+        Point565{90, 35},
+        Point565{120, 80}
+    };
+
+    int offset{0};
+
+    for (const auto join : { LineJoin::MITER, LineJoin::BEVEL, LineJoin::ROUND })
+    {
+        std::vector<Point565> shifted;
+
+        for (const auto& p : trace)
+        {
+            shifted.emplace_back(p.x() + offset, p.y() + offset);
+        }
+
+        polylineThick(iface, shifted, 6, c_white, join, LineCap::SQUARE);
+        offset += 15;
+    }
+}
+
+//-------------------------------------------------------------------------
+
+bool
+testShapes()
+{
+    bool passed{true};
+
+    // a rounded box with no radius is a box, and one with an outline as
+    // wide as half its height is filled
+
+    passed &= check("rounded box without radius",
+                    drawn([](Image565& i) { boxRoundedFilled(i, Point565{10, 10}, Point565{100, 70}, 0, c_white); }),
+                    drawn([](Image565& i) { boxFilled(i, Point565{10, 10}, Point565{100, 70}, c_white); }));
+
+    passed &= check("rounded box outline",
+                    drawn([](Image565& i) { boxRounded(i, Point565{10, 10}, Point565{100, 70}, 12, 40, c_white); }),
+                    drawn([](Image565& i) { boxRoundedFilled(i, Point565{10, 10}, Point565{100, 70}, 12, c_white); }));
+
+    // a full turn of an arc is a ring, as are two arcs that meet
+
+    for (const auto width : { 2, 5, 8 })
+    {
+        passed &= check("arc of a full turn",
+                        drawn([=](Image565& i) { arc(i, c_centre, 40, 0.0f, 360.0f, width, c_white); }),
+                        drawn([=](Image565& i) { circleThick(i, c_centre, 40, width, c_white); }));
+    }
+
+    passed &= check("arcs that meet",
+                    drawn([](Image565& i)
+                    {
+                        arc(i, c_centre, 40, 10.0f, 100.0f, 6, c_white);
+                        arc(i, c_centre, 40, 100.0f, 370.0f, 6, c_white);
+                    }),
+                    drawn([](Image565& i) { circleThick(i, c_centre, 40, 6, c_white); }));
+
+    passed &= check("pie slices that meet",
+                    drawn([](Image565& i)
+                    {
+                        arcFilled(i, c_centre, 40, 30.0f, 150.0f, c_white);
+                        arcFilled(i, c_centre, 40, 150.0f, 390.0f, c_white);
+                    }),
+                    drawn([](Image565& i) { arcFilled(i, c_centre, 40, 0.0f, 360.0f, c_white); }));
+
+    // a thick line is the same drawn either way
+
+    for (const auto cap : { LineCap::BUTT, LineCap::SQUARE, LineCap::ROUND })
+    {
+        for (const auto width : { 1, 2, 3, 6, 9 })
+        {
+            passed &= check("thick line reversed",
+                            drawn([=](Image565& i) { lineThick(i, Point565{5, 7}, Point565{150, 90}, width, c_white, cap); }),
+                            drawn([=](Image565& i) { lineThick(i, Point565{150, 90}, Point565{5, 7}, width, c_white, cap); }));
+        }
+    }
+
+    // rings and rounded boxes are symmetric
+
+    passed &= check("ring mirrored",
+                    drawn([](Image565& i) { circleThick(i, Point565{79, 60}, 30, 7, c_white); }),
+                    mirrored(drawn([](Image565& i) { circleThick(i, Point565{80, 60}, 30, 7, c_white); })));
+
+    passed &= check("rounded box mirrored",
+                    drawn([](Image565& i) { boxRounded(i, Point565{20, 10}, Point565{139, 100}, 15, 4, c_white); }),
+                    mirrored(drawn([](Image565& i) { boxRounded(i, Point565{20, 10}, Point565{139, 100}, 15, 4, c_white); })));
+
+    // drawing with a clip is the same as drawing without one, inside it
+
+    const Rectangle565 clip{Point565{30, 20}, Point565{110, 90}};
+    const auto full = drawn(drawWidgets);
+    const auto clipped = drawn([&](Image565& i)
+    {
+        ScopedClip565 scopedClip{i, clip};
+        drawWidgets(i);
+    });
+
+    auto expected = drawn([&](Image565& i)
+    {
+        for (auto y = clip.top() ; y <= clip.bottom() ; ++y)
+        {
+            for (auto x = clip.left() ; x <= clip.right() ; ++x)
+            {
+                const Point565 p{x, y};
+                i.setPixel(p, full.getPixel(p).value_or(0));
+            }
+        }
+    });
+
+    passed &= check("clipped", clipped, expected);
+
+    return passed;
+}
+
+//-------------------------------------------------------------------------
+
+void
+printUsage(
+    std::ostream& stream,
+    const std::string& name)
+{
+    std::println(stream, "");
+    std::println(stream, "Usage: {}", name);
+    std::println(stream, "");
+    std::println(stream, "    --help,-h - print usage and exit");
+    std::println(stream, "");
+}
+
+//-------------------------------------------------------------------------
+
+} // namespace
+
+//-------------------------------------------------------------------------
+
+int
+main(
+    int argc,
+    char *argv[])
+{
+    const std::string program{basename(argv[0])};
+
+    //---------------------------------------------------------------------
+
+    static const char* sopts = "h";
+    static option lopts[] =
+    {
+        { "help", no_argument, nullptr, 'h' },
+        { nullptr, no_argument, nullptr, 0 }
+    };
+
+    int opt{};
+
+    while ((opt = ::getopt_long(argc, argv, sopts, lopts, nullptr)) != -1)
+    {
+        switch (opt)
+        {
+        case 'h':
+
+            printUsage(std::cout, program);
+            ::exit(EXIT_SUCCESS);
+            break;
+
+        default:
+
+            printUsage(std::cerr, program);
+            ::exit(EXIT_FAILURE);
+            break;
+        }
+    }
+
+    //---------------------------------------------------------------------
+
+    std::println("strokes");
+
+    const bool passed = testShapes();
+
+    std::println("    {}", (passed) ? "passed" : "FAILED");
+
+    return (passed) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,367 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+#include <getopt.h>
+#include <libgen.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <initializer_list>
+#include <iostream>
+#include <memory>
+#include <print>
+#include <string>
+#include <vector>
+
+#include "bitmapGlyph565.h"
+#include "fontConfig.h"
+#include "image565.h"
+#include "image565Font8x16.h"
+#include "image565Font8x8.h"
+#include "image565FreeType.h"
+#include "point.h"
+#include "rectangle.h"
+#include "textRun565.h"
+
+//-------------------------------------------------------------------------
+
+using namespace fb16;
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+constexpr RGB565 c_background{0, 0, 64};
+constexpr RGB565 c_yellow{255, 255, 0};
+
+//-------------------------------------------------------------------------
+
+bool
+check(
+    const std::string& name,
+    bool condition)
+{
+    if (not condition)
+    {
+        std::println(std::cerr, "    {} failed", name);
+    }
+
+    return condition;
+}
+
+//-------------------------------------------------------------------------
+
+// Draw labels at many positions, some of them off the edges of the image
+// or its clip, with drawString() and from a text run, and check they are
+// the same.
+
+bool
+testLabels(
+    Interface565Font& font,
+    const std::string& name,
+    bool timing)
+{
+    const Dimensions565 d{240, 160};
+    const auto fd = font.getPixelDimensions();
+    const std::vector<std::string> labels
+    {
+        "temperature 48.2 C (user: 12.5%)",
+        "AVAWATo yj\nsecond line",
+        ""
+    };
+
+    bool passed{true};
+
+    for (const auto clipped : { false, true })
+    {
+        for (const auto& label : labels)
+        {
+            std::vector<Point565> positions;
+
+            for (auto y = -fd.height() / 2 ; y < d.height() ; y += fd.height() + 2)
+            {
+                positions.emplace_back(((y / 3) % 80) - 40, y);
+            }
+
+            Image565 direct{d};
+            Image565 run{d};
+
+            direct.clear(c_background);
+            run.clear(c_background);
+
+            if (clipped)
+            {
+                const Rectangle565 clip{Point565{13, 9}, Point565{200, 131}};
+                direct.pushClip(clip);
+                run.pushClip(clip);
+            }
+
+            const auto directStart = std::chrono::steady_clock::now();
+
+            std::vector<Point565> directEnds;
+
+            for (const auto& p : positions)
+            {
+                directEnds.push_back(font.drawString(p, label, c_yellow, direct));
+            }
+
+            const auto runStart = std::chrono::steady_clock::now();
+
+            const TextRun565 textRun{font, label, c_yellow};
+            std::vector<Point565> runEnds;
+
+            for (const auto& p : positions)
+            {
+                runEnds.push_back(textRun.draw(run, p));
+            }
+
+            const auto runEnd = std::chrono::steady_clock::now();
+
+            passed &= check(name + " labels", std::ranges::equal(direct.getBuffer(), run.getBuffer()));
+            passed &= check(name + " end positions", directEnds == runEnds);
+
+            if (timing and (not clipped) and (label == labels.front()))
+            {
+                std::println("    {} labels, drawString {} us, text run {} us",
+                             positions.size(),
+                             std::chrono::duration_cast<std::chrono::microseconds>(runStart - directStart).count(),
+                             std::chrono::duration_cast<std::chrono::microseconds>(runEnd - runStart).count());
+            }
+        }
+    }
+
+    return passed;
+}
+
+//-------------------------------------------------------------------------
+
+bool
+testBitmapFonts(
+    bool timing)
+{
+    std::println("bitmap fonts");
+
+    bool passed{true};
+
+    Image565Font8x8 font8x8;
+    Image565Font8x16 font8x16;
+
+    for (const auto& style : { BitmapFontStyle565{},
+                               BitmapFontStyle565{1, false, true, true},
+                               BitmapFontStyle565{2, true, false, false},
+                               BitmapFontStyle565{3, true, true, true} })
+    {
+        font8x8.setStyle(style);
+        font8x16.setStyle(style);
+
+        passed &= testLabels(font8x8, "8x8", timing);
+        passed &= testLabels(font8x16, "8x16", timing);
+    }
+
+    // a run is rasterised again when the style changes, even if the size
+    // does not
+
+    font8x16.setStyle(BitmapFontStyle565{});
+
+    TextRun565 run{font8x16, "Hi", c_yellow};
+
+    passed &= check("unchanged run", not run.set(font8x16, "Hi", c_yellow));
+
+    font8x16.setStyle(BitmapFontStyle565{1, false, true, false});
+
+    passed &= check("run after a style change", run.set(font8x16, "Hi", c_yellow));
+
+    // a new colour is used without rasterising again
+
+    constexpr RGB565 c_red{255, 0, 0};
+
+    Image565 direct{Dimensions565{32, 32}};
+    Image565 recoloured{Dimensions565{32, 32}};
+
+    direct.clear(c_background);
+    recoloured.clear(c_background);
+
+    passed &= check("run after a colour change", not run.set(font8x16, "Hi", c_red));
+
+    font8x16.drawString(Point565{3, 3}, "Hi", c_red, direct);
+    run.draw(recoloured, Point565{3, 3});
+
+    passed &= check("recoloured run", std::ranges::equal(direct.getBuffer(), recoloured.getBuffer()));
+
+    // a font made where an old one was is not the old one
+
+    TextRun565 reused;
+
+    {
+        Image565Font8x16 font;
+        reused.set(font, "Hi", c_yellow);
+    }
+
+    {
+        Image565Font8x16 font;
+        passed &= check("run from a new font", reused.set(font, "Hi", c_yellow));
+    }
+
+    std::println("    {}", (passed) ? "passed" : "FAILED");
+
+    return passed;
+}
+
+//-------------------------------------------------------------------------
+
+bool
+testFreeTypeFont(
+    Image565FreeType& font,
+    bool timing)
+{
+    std::println("FreeType font");
+
+    bool passed{true};
+
+    for (const auto lcd : { false, true })
+    {
+        font.setLcdRendering(lcd);
+        passed &= testLabels(font, (lcd) ? "LCD" : "greyscale", timing);
+    }
+
+    // a run is rasterised again when the rendering or size changes
+
+    font.setLcdRendering(false);
+
+    TextRun565 run{font, "Hi", c_yellow};
+
+    font.setLcdRendering(true);
+
+    passed &= check("run after an LCD change", run.set(font, "Hi", c_yellow));
+
+    font.setPixelSize(font.getPixelSize() + 4);
+
+    passed &= check("run after a size change", run.set(font, "Hi", c_yellow));
+
+    std::println("    {}", (passed) ? "passed" : "FAILED");
+
+    return passed;
+}
+
+//-------------------------------------------------------------------------
+
+void
+printUsage(
+    std::ostream& stream,
+    const std::string& name)
+{
+    std::println(stream, "");
+    std::println(stream, "Usage: {}", name);
+    std::println(stream, "");
+    std::println(stream, "    --font,-f - also test a FreeType font file[:pixel height]");
+    std::println(stream, "    --help,-h - print usage and exit");
+    std::println(stream, "    --time,-t - time drawString() and the text run");
+    std::println(stream, "");
+}
+
+//-------------------------------------------------------------------------
+
+} // namespace
+
+//-------------------------------------------------------------------------
+
+int
+main(
+    int argc,
+    char *argv[])
+{
+    const std::string program{basename(argv[0])};
+    FontConfig fontConfig{};
+    bool timing{false};
+
+    //---------------------------------------------------------------------
+
+    static const char* sopts = "f:ht";
+    static option lopts[] =
+    {
+        { "font", required_argument, nullptr, 'f' },
+        { "help", no_argument, nullptr, 'h' },
+        { "time", no_argument, nullptr, 't' },
+        { nullptr, no_argument, nullptr, 0 }
+    };
+
+    int opt{};
+
+    while ((opt = ::getopt_long(argc, argv, sopts, lopts, nullptr)) != -1)
+    {
+        switch (opt)
+        {
+        case 'f':
+
+            fontConfig = fb16::parseFontConfig(optarg, 20);
+            break;
+
+        case 'h':
+
+            printUsage(std::cout, program);
+            ::exit(EXIT_SUCCESS);
+            break;
+
+        case 't':
+
+            timing = true;
+            break;
+
+        default:
+
+            printUsage(std::cerr, program);
+            ::exit(EXIT_FAILURE);
+            break;
+        }
+    }
+
+    //---------------------------------------------------------------------
+
+    bool passed{true};
+
+    passed &= testBitmapFonts(timing);
+
+    if (not fontConfig.m_fontFile.empty())
+    {
+        auto font = createFont(fontConfig);
+        auto* freeType = dynamic_cast<Image565FreeType*>(font.get());
+
+        if (freeType == nullptr)
+        {
+            std::println(std::cerr, "Error: cannot open {}", fontConfig.m_fontFile);
+            return EXIT_FAILURE;
+        }
+
+        passed &= testFreeTypeFont(*freeType, timing);
+    }
+
+    return (passed) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,321 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+#include <getopt.h>
+#include <libgen.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <print>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "image565.h"
+#include "image565Graphics.h"
+#include "point.h"
+#include "rectangle.h"
+#include "spriteAtlas565.h"
+#include "tileMap565.h"
+
+//-------------------------------------------------------------------------
+
+using namespace fb16;
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+constexpr Dimensions565 c_tileSize{16, 16};
+constexpr int c_tileCount{8};
+
+//-------------------------------------------------------------------------
+
+bool
+check(
+    const std::string& name,
+    bool condition)
+{
+    if (not condition)
+    {
+        std::println(std::cerr, "    {} failed", name);
+    }
+
+    return condition;
+}
+
+//-------------------------------------------------------------------------
+
+// Eight tiles, each a different colour with a white border.
+
+SpriteAtlas565
+makeTiles()
+{
+    SpriteAtlas565 atlas;
+
+    for (auto i = 0 ; i < c_tileCount ; ++i)
+    {
+        Image565 tile{c_tileSize};
+
+        tile.clear(RGB565(64 + (i * 24), 255 - (i * 24), 128));
+        box(tile,
+            Point565{0, 0},
+            Point565{c_tileSize.width() - 1, c_tileSize.height() - 1},
+            RGB565(255, 255, 255));
+
+        atlas.add(tile);
+    }
+
+    return atlas;
+}
+
+//-------------------------------------------------------------------------
+
+// Change a few tiles each frame and draw only those. Each frame only the
+// pixels inside the reported damage may change, and at the end the image
+// must match drawing every tile afresh.
+
+bool
+testFrames(
+    const SpriteAtlas565& atlas,
+    int zoom,
+    Point565 origin,
+    bool timing)
+{
+    const Dimensions565 d{317, 203};
+    const Dimensions565 grid{d.width() / (c_tileSize.width() * zoom) + 1,
+                             d.height() / (c_tileSize.height() * zoom) + 1};
+
+    TileMap565 tileMap{c_tileSize, grid};
+    tileMap.setZoom(zoom);
+    tileMap.setOrigin(origin);
+    tileMap.setReportDamage(true);
+
+    Image565 incremental{d};
+
+    std::mt19937 generator{565};
+    std::uniform_int_distribution<int> column(0, grid.width() - 1);
+    std::uniform_int_distribution<int> row(0, grid.height() - 1);
+    std::uniform_int_distribution<int> sprite(0, c_tileCount - 1);
+
+    constexpr int frames{100};
+    constexpr int changesPerFrame{4};
+    long damagedPixels{0};
+    std::chrono::microseconds drawTime{0};
+    bool passed{true};
+
+    for (auto frame = 0 ; frame < frames ; ++frame)
+    {
+        for (auto change = 0 ; change < changesPerFrame ; ++change)
+        {
+            const Point565 cell{column(generator), row(generator)};
+            tileMap.setTile(cell, sprite(generator));
+        }
+
+        const Image565 previous{incremental};
+        incremental.clearDamage();
+
+        const auto start = std::chrono::steady_clock::now();
+        tileMap.draw(incremental, atlas);
+        drawTime += std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start);
+
+        const auto damage = incremental.getDamage();
+
+        for (const auto& area : damage)
+        {
+            damagedPixels += area.width() * area.height();
+        }
+
+        for (auto y = 0 ; y < d.height() ; ++y)
+        {
+            for (auto x = 0 ; x < d.width() ; ++x)
+            {
+                const Point565 p{x, y};
+
+                if (incremental.getPixel(p) != previous.getPixel(p))
+                {
+                    const bool damaged = std::ranges::any_of(damage, [p](const Rectangle565& area)
+                    {
+                        return area.contains(p);
+                    });
+
+                    passed &= check("change outside of damage", damaged);
+                }
+            }
+        }
+    }
+
+    passed &= check("nothing left to draw", not tileMap.draw(incremental, atlas));
+
+    Image565 full{d};
+    tileMap.invalidate();
+    tileMap.draw(full, atlas);
+
+    passed &= check("incremental drawing",
+                    std::ranges::equal(full.getBuffer(), incremental.getBuffer()));
+
+    std::println("{}x{} tiles zoom {} origin {},{} {}",
+                 grid.width(),
+                 grid.height(),
+                 zoom,
+                 origin.x(),
+                 origin.y(),
+                 (passed) ? "passed" : "FAILED");
+
+    if (timing)
+    {
+        std::println("    {} frames, {} us drawing, {} pixels damaged per frame of {}",
+                     frames,
+                     drawTime.count(),
+                     damagedPixels / frames,
+                     d.width() * d.height());
+    }
+
+    return passed;
+}
+
+//-------------------------------------------------------------------------
+
+bool
+testErrors()
+{
+    bool passed{true};
+
+    auto throws = [](auto function) -> bool
+    {
+        try
+        {
+            function();
+        }
+        catch (const std::exception&)
+        {
+            return true;
+        }
+
+        return false;
+    };
+
+    TileMap565 tileMap{c_tileSize, Dimensions565{4, 3}};
+
+    passed &= check("empty grid", throws([] { TileMap565{c_tileSize, Dimensions565{0, 3}}; }));
+    passed &= check("empty tile", throws([] { TileMap565{Dimensions565{16, 0}, Dimensions565{4, 3}}; }));
+    passed &= check("cell outside grid", throws([&] { tileMap.setTile(Point565{4, 0}, 1); }));
+    passed &= check("negative cell", throws([&] { tileMap.setTile(Point565{0, -1}, 1); }));
+    passed &= check("zero zoom", throws([&] { tileMap.setZoom(0); }));
+
+    std::println("errors {}", (passed) ? "passed" : "FAILED");
+
+    return passed;
+}
+
+//-------------------------------------------------------------------------
+
+void
+printUsage(
+    std::ostream& stream,
+    const std::string& name)
+{
+    std::println(stream, "");
+    std::println(stream, "Usage: {}", name);
+    std::println(stream, "");
+    std::println(stream, "    --help,-h - print usage and exit");
+    std::println(stream, "    --time,-t - time drawing the tiles");
+    std::println(stream, "");
+}
+
+//-------------------------------------------------------------------------
+
+} // namespace
+
+//-------------------------------------------------------------------------
+
+int
+main(
+    int argc,
+    char *argv[])
+{
+    const std::string program{basename(argv[0])};
+    bool timing{false};
+
+    //---------------------------------------------------------------------
+
+    static const char* sopts = "ht";
+    static option lopts[] =
+    {
+        { "help", no_argument, nullptr, 'h' },
+        { "time", no_argument, nullptr, 't' },
+        { nullptr, no_argument, nullptr, 0 }
+    };
+
+    int opt{};
+
+    while ((opt = ::getopt_long(argc, argv, sopts, lopts, nullptr)) != -1)
+    {
+        switch (opt)
+        {
+        case 'h':
+
+            printUsage(std::cout, program);
+            ::exit(EXIT_SUCCESS);
+            break;
+
+        case 't':
+
+            timing = true;
+            break;
+
+        default:
+
+            printUsage(std::cerr, program);
+            ::exit(EXIT_FAILURE);
+            break;
+        }
+    }
+
+    //---------------------------------------------------------------------
+
+    const auto atlas = makeTiles();
+    bool passed{true};
+
+    for (const auto zoom : { 1, 2, 3 })
+    {
+        for (const auto origin : { Point565{0, 0}, Point565{-5, 7} })
+        {
+            passed &= testFrames(atlas, zoom, origin, timing);
+        }
+    }
+
+    passed &= testErrors();
+
+    return (passed) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -50,10 +50,11 @@
 #include <thread>
 #include <vector>
 
+#include "fontConfig.h"
 #include "image565.h"
-#include "image565Font8x16.h"
 #include "interface565Factory.h"
 #include "scanEntry.h"
+#include "textLayout565.h"
 
 //-------------------------------------------------------------------------
 
@@ -95,6 +96,7 @@ printUsage(
     std::println(stream, "");
     std::println(stream, "    --active,-a - use active scan");
     std::println(stream, "    --device,-d - device to use");
+    std::println(stream, "    --font,-f - font file[,fallback font file...][:pixel height]");
     std::println(stream, "    --help,-h - print usage and exit");
     std::println(stream, "    --interface,-i - WiFi interface to use");
     std::println(stream, "    --kmsdrm,-k - use KMS/DRM dumb buffer");
@@ -113,14 +115,16 @@ main(
     auto interfaceType{fb16::InterfaceType565::FRAME_BUFFER_565};
     int iwScanType{IW_SCAN_TYPE_PASSIVE};
     std::string interfaceName{"wlan0"};
+    FontConfig fontConfig{};
 
     //---------------------------------------------------------------------
 
-    static const char* sopts = "ad:hi:k";
+    static const char* sopts = "ad:f:hi:k";
     static option lopts[] =
     {
         { "active", no_argument, nullptr, 'a' },
         { "device", required_argument, nullptr, 'd' },
+        { "font", required_argument, nullptr, 'f' },
         { "help", no_argument, nullptr, 'h' },
         { "interface", required_argument, nullptr, 'i' },
         { "kmsdrm", no_argument, nullptr, 'k' },
@@ -144,6 +148,11 @@ main(
 
             break;
 
+        case 'f':
+
+            fontConfig = fb16::parseFontConfig(optarg, 16);
+            break;
+
         case 'h':
 
             printUsage(std::cout, program);
@@ -215,7 +224,10 @@ main(
 
         //-----------------------------------------------------------------
 
-        Image565Font8x16 font;
+        // SSIDs are often UTF-8, which a FreeType font (with fallbacks)
+        // can draw
+
+        auto font{fb16::createFont(fontConfig)};
         auto fb{fb16::createInterface565(interfaceType, device)};
         Image565 image{fb->getDimensions()};
 
@@ -411,15 +423,25 @@ main(
                 image.clear(RGB565{0, 0, 0});
                 Point565 position{0, 0};
                 constexpr RGB565 white{255, 255, 255};
+                const auto d = image.getDimensions();
+
+                // only lay out the entries and text that fit on the screen
 
                 for (const auto& entry : cells)
                 {
-                    position = font.drawString(position,
-                                               entry.asString(),
-                                               white,
-                                               image);
+                    if (position.y() >= d.height())
+                    {
+                        break;
+                    }
+
+                    position = font->drawString(position,
+                                                fb16::elideText(*font,
+                                                                entry.asString(),
+                                                                d.width()),
+                                                white,
+                                                image);
 
-                    position.set(0, position.y() + font.getPixelDimensions().height());
+                    position.set(0, position.y() + font->getPixelDimensions().height());
                 }
 
                 fb->putImage(Point565{0, 0}, image);